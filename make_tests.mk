@@ -5,7 +5,7 @@ T_SRCDIR := $(TESTS_DIR)/src
 
 TIMEOUT_OPTS := --preserve-status
 
-UTILITY_FUNCS := $(SRC_DIR)/mem_funcs.c $(SRC_DIR)/string_funcs.c $(SRC_DIR)/array_funcs.c
+UTILITY_FUNCS := $(SRC_DIR)/mem_funcs.c $(SRC_DIR)/string_funcs.c $(SRC_DIR)/array_funcs.c $(SRC_DIR)/limb_funcs.c
 T_SRCS = $(shell find "$(T_SRCDIR)" -mount -name 'test_*.c' -type f | sort)
 T_BINS = $(T_SRCS:$(T_SRCDIR)/%.c=$(T_BINDIR)/%)
 T_DEPS = $(T_BINS:%=%.d)
@@ -18,8 +18,16 @@ tests: unit-tests
 $(T_BINDIR):
 	@mkdir -p $@
 
+$(T_BINDIR)/test_converters: $(SRC_DIR)/panic.c
 $(T_BINDIR)/test_infiX_mul: $(SRC_DIR)/infiX_add.c
 $(T_BINDIR)/test_infiX_div: $(SRC_DIR)/infiX_add.c $(SRC_DIR)/infiX_sub.c $(SRC_DIR)/infiX_mul.c
+$(T_BINDIR)/test_infiX_decimal: $(SRC_DIR)/infiX_add.c $(SRC_DIR)/infiX_sub.c $(SRC_DIR)/infiX_mul.c $(SRC_DIR)/infiX_div.c $(SRC_DIR)/infiX_shift.c $(SRC_DIR)/converters.c $(SRC_DIR)/panic.c
+$(T_BINDIR)/test_infiX_float: $(SRC_DIR)/infiX_decimal.c $(SRC_DIR)/infiX_add.c $(SRC_DIR)/infiX_sub.c $(SRC_DIR)/infiX_mul.c $(SRC_DIR)/infiX_div.c $(SRC_DIR)/infiX_shift.c $(SRC_DIR)/converters.c $(SRC_DIR)/panic.c
+$(T_BINDIR)/test_infiX_rational: $(SRC_DIR)/infiX_add.c $(SRC_DIR)/infiX_sub.c $(SRC_DIR)/infiX_mul.c $(SRC_DIR)/infiX_div.c $(SRC_DIR)/infiX_residue.c $(SRC_DIR)/converters.c $(SRC_DIR)/panic.c
+$(T_BINDIR)/test_infiX_digits: $(SRC_DIR)/converters.c $(SRC_DIR)/panic.c
+$(T_BINDIR)/test_infiX_bits: $(SRC_DIR)/infiX_radix.c $(SRC_DIR)/infiX_add.c $(SRC_DIR)/infiX_sub.c $(SRC_DIR)/infiX_mul.c $(SRC_DIR)/infiX_shift.c $(SRC_DIR)/converters.c $(SRC_DIR)/panic.c
+$(T_BINDIR)/test_infiX_radix: $(SRC_DIR)/infiX_add.c $(SRC_DIR)/infiX_sub.c $(SRC_DIR)/infiX_mul.c $(SRC_DIR)/infiX_shift.c $(SRC_DIR)/converters.c $(SRC_DIR)/panic.c
+$(T_BINDIR)/test_sparse_u4b: $(SRC_DIR)/infiX_add.c $(SRC_DIR)/infiX_sub.c
 
 $(T_BINDIR)/test_%: $(T_SRCDIR)/test_%.c $(SRC_DIR)/%.c $(UTILITY_FUNCS)
 	$(CC) $(CFLAGS) $(filter-out %.h,$^) -o $@
@@ -24,36 +24,90 @@ void trim_u4b_array(u4b_array *arr)
 	}
 }
 
+/**
+ * is_normalized_u4b_array - check if a u4b_array has been trimmed.
+ * @arr: pointer to a u4b_array struct
+ *
+ * Return: 1 if arr has no leading zeros and is not -0, else 0.
+ */
+int is_normalized_u4b_array(const u4b_array *arr)
+{
+	if (!arr)
+		return (1);
+
+	if (!arr->len || !arr->array)
+		return (!arr->len && !arr->is_negative);
+
+	if (arr->len == 1)
+		return (arr->array[0] || !arr->is_negative);
+
+	return (arr->array[arr->len - 1] != 0);
+}
+
+/**
+ * slice_u4b_array - make a view over a range of a u4b_array's limbs.
+ * @arr: pointer to the u4b_array struct
+ * @start: index of the first limb in the view
+ * @len: number of limbs in the view
+ *
+ * Description: the view does not own or copy the limbs, it is only valid for
+ * as long as arr's buffer is. The range is clamped to arr's length and the
+ * view takes arr's sign, which can be changed without affecting arr.
+ *
+ * Return: the view, a 0 length view if arr is NULL.
+ */
+u4b_array slice_u4b_array(const u4b_array *arr, size_t start, size_t len)
+{
+	u4b_array view = {.len = 0, .capacity = 0, .is_negative = 0, .array = NULL};
+
+	if (!arr || !arr->array || start >= arr->len)
+		return (view);
+
+	if (len > arr->len - start)
+		len = arr->len - start;
+
+	view.len = len;
+	view.is_negative = arr->is_negative;
+	view.array = &arr->array[start];
+	return (view);
+}
+
 /**
  * cmp_u4barray - compare 2 u4b_arrays.
  * @a1: the first array
  * @a2: the second array
  *
+ * Description: leading zeros are ignored without changing either array.
+ *
  * Return: +ve number if a1 > a2, -ve number if a1 < a2 else 0.
  */
-ssize_t cmp_u4barray(u4b_array *a1, u4b_array *a2)
+ssize_t cmp_u4barray(const u4b_array *a1, const u4b_array *a2)
 {
+	u4b_array v1 = {0}, v2 = {0};
+
 	if (!a1 || !a2)
 		return (0);
 
-	trim_u4b_array(a1);
-	trim_u4b_array(a2);
-	if (a1->is_negative && a2->is_negative)
+	v1 = slice_u4b_array(a1, 0, a1->len);
+	v2 = slice_u4b_array(a2, 0, a2->len);
+	trim_u4b_array(&v1);
+	trim_u4b_array(&v2);
+	if (v1.is_negative && v2.is_negative)
 	{
-		if ((ssize_t)a2->len - a1->len)
-			return ((ssize_t)a2->len - a1->len);
+		if ((ssize_t)v2.len - v1.len)
+			return ((ssize_t)v2.len - v1.len);
 
-		return (cmp_rev_uint32array(a2->array, a1->array, a1->len));
+		return (cmp_rev_uint32array(v2.array, v1.array, v1.len));
 	}
-	else if (a1->is_negative)
+	else if (v1.is_negative)
 		return (-1);
-	else if (a2->is_negative)
+	else if (v2.is_negative)
 		return (1);
 
-	if ((ssize_t)a1->len - a2->len)
-		return ((ssize_t)a1->len - a2->len);
+	if ((ssize_t)v1.len - v2.len)
+		return ((ssize_t)v1.len - v2.len);
 
-	return (cmp_rev_uint32array(a1->array, a2->array, a1->len));
+	return (cmp_rev_uint32array(v1.array, v2.array, v1.len));
 }
 
 /**
@@ -64,7 +118,7 @@ ssize_t cmp_u4barray(u4b_array *a1, u4b_array *a2)
  *
  * Return: +ve number if arr1 > arr2, -ve number if arr1 < arr2 else 0.
  */
-ssize_t cmp_rev_uint32array(uint32_t *arr1, uint32_t *arr2, size_t len)
+ssize_t cmp_rev_uint32array(const uint32_t *arr1, const uint32_t *arr2, size_t len)
 {
 	size_t i = len ? len - 1 : 0;
 
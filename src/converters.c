@@ -1,83 +1,176 @@
 #include "infiX.h"
 
+static int parse_exponent(const char *exp_str, size_t *exponent) ATTR_NONNULL;
+static u4b_array *sci_to_intarray(const char *num_str, const char *e) ATTR_NONNULL;
+
+/**
+ * parse_exponent - read the exponent of a number in scientific notation.
+ * @exp_str: the characters after the 'e', digits with an optional leading
+ * '+' and any separators ',' or ' ', or '_' between two digits
+ * @exponent: where to store the exponent
+ *
+ * Return: 0 on success, -1 if the exponent is not a whole number that fits
+ * a size_t
+ */
+int parse_exponent(const char *exp_str, size_t *exponent)
+{
+	size_t i = 0, digits = 0;
+
+	*exponent = 0;
+	if (exp_str[0] == '+')
+		i++;
+
+	if (misplaced_underscore(&exp_str[i], strlen(&exp_str[i])))
+		return (-1);
+
+	for (; exp_str[i]; i++)
+	{
+		if (exp_str[i] == ',' || exp_str[i] == ' ' || exp_str[i] == '_')
+			continue;
+
+		if (exp_str[i] < '0' || exp_str[i] > '9' ||
+			*exponent > (SIZE_MAX - (size_t)(exp_str[i] - '0')) / 10)
+			return (-1);
+
+		*exponent = *exponent * 10 + (size_t)(exp_str[i] - '0');
+		digits++;
+	}
+
+	return (digits ? 0 : -1);
+}
+
 /**
- * str_to_intarray - convert a string of numbers to a uint32_t u32array.
- * @num_str: a pointer to a string of numbers
+ * sci_to_intarray - convert a number in scientific notation to a u4b_array.
+ * @num_str: the number, e.g. "-3e50" or "1_000e12", with at least one digit
+ * before the 'e'
+ * @e: the 'e' or 'E' in num_str
  *
- * Description: This function converts a string of numbers to a uint32_t u32array.
- * The u32array will be in little endian order whereby the lower value numbers
- * will be placed in the lower indices. Index 0 will have a value indicating
- * the size of the u32array.
+ * Description: only the mantissa is parsed as digits. It is then moved up
+ * exponent / MAX_DIGITS_u4b whole limbs and multiplied by the remaining
+ * power of ten in one limbs_mul_1() pass, so the zeros are never written out
+ * as a string.
  *
- * Return: pointer to an uint32_t u32array, NULL on failure
+ * Return: pointer to a normalized u4b_array, NULL on failure
  */
-uint32_t *str_to_intarray(const char *num_str)
+u4b_array *sci_to_intarray(const char *num_str, const char *e)
 {
-	uint32_t *u32array = NULL;
-	size_t arr_size = 0, h = 0;
-	int i = 0, g = 0;
+	u4b_array *mantissa = NULL, *arr = NULL;
+	size_t exponent = 0, limbs = 0, i = 0;
+	uint32_t scale = 1;
+	char *digits = NULL;
+
+	/*"e5" and "-e5" have no mantissa, they are not 0.*/
+	for (i = 0; &num_str[i] < e && !isdigit((unsigned char)num_str[i]); i++)
+		;
+
+	if (&num_str[i] == e || parse_exponent(&e[1], &exponent))
+	{
+		panic("exponent");
+		return (NULL);
+	}
+
+	digits = xcalloc(e - num_str + 1, sizeof(*digits));
+	if (!digits)
+		return (NULL);
+
+	memcpy(digits, num_str, e - num_str);
+	mantissa = str_to_intarray(digits);
+	digits = free_n_null(digits);
+	/*Zero stays as str_to_intarray() made it.*/
+	if (!mantissa || !mantissa->len || (mantissa->len == 1 && !mantissa->array[0]))
+		return (mantissa);
+
+	limbs = exponent / MAX_DIGITS_u4b;
+	for (i = 0; i < exponent % MAX_DIGITS_u4b; i++)
+		scale *= 10;
+
+	if (limbs < SIZE_MAX - mantissa->len - 1)
+		arr = alloc_u4b_array(mantissa->len + limbs + 1);
+
+	if (arr)
+	{
+		arr->array[mantissa->len + limbs] =
+			limbs_mul_1(&arr->array[limbs], mantissa->array, mantissa->len, scale);
+		arr->is_negative = mantissa->is_negative;
+		trim_u4b_array(arr);
+	}
+
+	mantissa = free_u4b_array(mantissa);
+	return (arr);
+}
+
+/**
+ * str_to_intarray - convert a string of numbers to a u4b_array.
+ * @num_str: a pointer to a string of numbers, optionally in scientific
+ * notation with a whole exponent ("3e50000000", "1_000E+12")
+ *
+ * Description: the limbs will be in little endian order whereby the lower
+ * value numbers will be placed in the lower indices. NULL and empty strings
+ * convert to 0. The digits may be separated with ',' or ' ', or with '_'
+ * between two digits.
+ *
+ * Return: pointer to a normalized u4b_array, NULL on failure
+ */
+u4b_array *str_to_intarray(const char *num_str)
+{
+	u4b_array *arr = NULL;
+	size_t arr_size = 0, h = 0, g = 0;
+	uint32_t power = 1;
 	str_array *attrs = NULL;
+	const char *e = num_str ? strpbrk(num_str, "eE") : NULL;
+
+	if (e)
+		return (sci_to_intarray(num_str, e));
 
 	attrs = parse_numstr(num_str);
 	if (!num_str || !num_str[0] || (attrs && !attrs->digits))
 	{
-		u32array = xcalloc(2, sizeof(*u32array));
-		if (u32array)
-			u32array[0] = 1;
-
+		arr = alloc_u4b_array(1);
 		if (attrs)
 			attrs->str = free_n_null(attrs->str);
 
 		attrs = free_n_null(attrs);
-		return (u32array);
+		return (arr);
 	}
 
 	if (!attrs)
 		return (NULL);
 
 	arr_size = (attrs->digits / MAX_DIGITS_u4b) + ((attrs->digits % MAX_DIGITS_u4b) ? 1 : 0);
-	u32array = xcalloc((arr_size + 1), sizeof(*u32array));
-	if (!u32array)
+	arr = alloc_u4b_array(arr_size);
+	if (arr)
 	{
-		attrs = free_n_null(attrs);
-		return (NULL);
-	}
-
-	/*Index 0 will have the size of the u32array*/
-	u32array[0] = arr_size;
-	/*The number in the string will be read from the least significant digit*/
-	for (h = 1, g = (attrs->len - 1); h <= arr_size && g >= 0; h++)
-	{
-		i = 0;
-		while (i < MAX_DIGITS_u4b && (g - i) >= 0)
+		/*The number in the string will be read from the least significant digit*/
+		for (g = attrs->len; g > 0; g--)
 		{
-			if (attrs->str[g - i] >= '0' && attrs->str[g - i] <= '9')
+			if (attrs->str[g - 1] < '0' || attrs->str[g - 1] > '9')
+				continue;
+
+			arr->array[h] += (attrs->str[g - 1] - '0') * power;
+			power *= 10;
+			if (power == MAX_VAL_u4b)
 			{
-				u32array[h] += (attrs->str[g - i] - '0') * (uint32_t)(pow(10, i));
-				i++;
+				power = 1;
+				h++;
 			}
-			else
-				g--;
 		}
 
-		g -= i;
+		arr->is_negative = attrs->is_negative;
+		trim_u4b_array(arr);
 	}
 
-	if (attrs->is_negative && u32array[arr_size] > 0)
-		u32array[arr_size] |= NEGBIT_u4b;
-
 	attrs->str = free_n_null(attrs->str);
 	attrs = free_n_null(attrs);
-	return (u32array);
+	return (arr);
 }
 
 /**
  * parse_numstr - strip the string of some leading chars and collect info
  * @num_str: a string of numbers.
  *
- * Description: the string will be stripped of leading "0", "," or " ". The
- * returned struct will store a copy of this resultant string, its length and
- * number of digits in it.
+ * Description: the string will be stripped of leading "0", ",", " " or "_".
+ * The returned struct will store a copy of this resultant string, its length
+ * and number of digits in it.
  *
  * Return: a struct with useful info about the number string.
  */
@@ -95,7 +188,13 @@ str_array *parse_numstr(const char *num_str)
 		ns.is_negative = 1;
 	}
 
-	ns.str += padding_chars_len((char *)ns.str, "0, ");
+	if (ns.str && misplaced_underscore((char *)ns.str, strlen((char *)ns.str)))
+	{
+		panic("invalid char");
+		return (NULL);
+	}
+
+	ns.str += padding_chars_len((char *)ns.str, "0, _");
 	for (i = 0; ns.str && ns.str[i]; i++)
 	{
 		if (ns.str[i] >= '0' && ns.str[i] <= '9')
@@ -103,7 +202,7 @@ str_array *parse_numstr(const char *num_str)
 			ns.digits++;
 			ns.len = i + 1;
 		}
-		else if (ns.str[i] != ',' && ns.str[i] != ' ')
+		else if (ns.str[i] != ',' && ns.str[i] != ' ' && ns.str[i] != '_')
 		{
 			if ((ns.str[i] >= 'a' && ns.str[i] <= 'z') ||
 				(ns.str[i] >= 'A' && ns.str[i] <= 'Z'))
@@ -118,14 +217,14 @@ str_array *parse_numstr(const char *num_str)
 	attributes = xcalloc(1, sizeof(*attributes));
 	if (attributes)
 	{
-		attributes->str = (uint8_t *)strndup((char *)ns.str, ns.len);
+		attributes->str = xcalloc(ns.len + 1, sizeof(*attributes->str));
 		if (!attributes->str)
 		{
-			perror("Malloc fail");
 			attributes = free_n_null(attributes);
 			return (NULL);
 		}
 
+		memmove(attributes->str, ns.str, ns.len);
 		attributes->len = ns.len;
 		attributes->digits = ns.digits;
 		attributes->is_negative = ns.is_negative;
@@ -135,67 +234,40 @@ str_array *parse_numstr(const char *num_str)
 }
 
 /**
- * intarr_to_str - convert a uint32_t u32array to a string of numbers.
- * @u32array: a uint32_t u32array
- *
- * Description: This function converts a uint32_t u32array to a string of numbers.
- * The u32array should be in little endian order whereby the lower value numbers
- * will be placed in the lower indices. Index 0 will have a value indicating
- * the size of the u32array.
+ * intarr_to_str - convert a u4b_array to a string of numbers.
+ * @arr: the u4b_array, its limbs in little endian order
  *
  * Return: a pointer to a string of numbers, NULL on failure
  */
-char *intarr_to_str(uint32_t *u32array)
+char *intarr_to_str(const u4b_array *arr)
 {
-	size_t arr_size = 0, len = 0, g = 0, h = 0, i = 0;
-	char *num_str = NULL, negative = '\0';
-	ssize_t temp = 0, div = 1;
+	u4b_array num = {0};
+	size_t h = 0, len = 0;
+	char *num_str = NULL;
+	int written = 0;
 
-	if (!u32array)
+	if (!arr)
 		return (NULL);
 
-	arr_size = u32array[0];
-	/*Checking if the number is negative*/
-	if (u32array[arr_size] > NEGBIT_u4b)
-	{
-		u32array[arr_size] ^= NEGBIT_u4b;
-		len += 1;
-		negative = '-';
-	}
-
-	trim_u4b_array(u32array);
-	arr_size = u32array[0];
-	len += arr_size * MAX_DIGITS_u4b;
-	num_str = xcalloc((len + 1), sizeof(*num_str));
+	num = slice_u4b_array(arr, 0, arr->len);
+	trim_u4b_array(&num);
+	/*Sign, all the limbs' digits and the null byte.*/
+	len = 1 + (num.len ? num.len : 1) * MAX_DIGITS_u4b + 1;
+	num_str = xcalloc(len, sizeof(*num_str));
 	if (!num_str)
 		return (NULL);
 
-	if (negative)
-		num_str++;
-
-	temp = u32array[arr_size];
-	while (temp / div >= 10)
-		div *= 10;
-
-	for (h = arr_size, g = 0; h > 0 && g < len; h--)
+	if (!num.len)
 	{
-		temp = u32array[h];
-		for (i = 0; div && (g + i) < len; i++)
-		{
-			num_str[g + i] = (temp / div) + '0';
-			temp %= div;
-			div /= 10;
-		}
-
-		g += i;
-		div = (MAX_VAL_u4b / 10);
+		num_str[0] = '0';
+		return (num_str);
 	}
 
-	if (negative)
-	{
-		num_str--;
-		num_str[0] = '-';
-	}
+	/*The most significant limb has no leading zeros, the rest are padded.*/
+	written = sprintf(num_str, "%s%" PRIu32, num.is_negative ? "-" : "",
+					  num.array[num.len - 1]);
+	for (h = num.len - 1; h > 0; h--)
+		written += sprintf(&num_str[written], "%09" PRIu32, num.array[h - 1]);
 
 	return (num_str);
 }
@@ -0,0 +1,189 @@
+#include "infiX.h"
+
+/*2^bits for each width, the first number a fixed<bits> can not hold.*/
+static const uint32_t fixed256_limit[FIXED256_LIMBS] = {
+	129639936, 584007913, 564039457, 984665640, 907853269, 985008687,
+	195423570, 89237316, 115792};
+
+static const uint32_t fixed512_limit[FIXED512_LIMBS] = {
+	6084096, 946433649, 811946569, 853753882, 186486050, 690031858,
+	166903427, 801874298, 73546976, 721764030, 723561443, 592393377,
+	479365820, 205846127, 574024998, 942597099, 407807929, 13};
+
+static const uint32_t fixed1024_limit[FIXED1024_LIMBS] = {
+	224137216, 356329624, 716304835, 245938479, 298239947, 510684586,
+	237163350, 110540827, 881473913, 682342462, 768838150, 952085005,
+	119453082, 601246094, 276302219, 424865485, 377767893, 639474124,
+	492847430, 814416622, 658789768, 871393357, 120113879, 407536021,
+	708477322, 500963132, 732675805, 430081157, 230657273, 797697894,
+	902473361, 930519078, 231590772, 769313486, 179};
+
+static const uint32_t fixed2048_limit[FIXED2048_LIMBS] = {
+	596230656, 853611059, 148193555, 478604952, 604645318, 135433229,
+	335543602, 166389437, 638215525, 268352998, 935045997, 580656697,
+	469678542, 726931323, 725157101, 710820209, 227125684, 233287231,
+	403697613, 301645904, 598351152, 461857357, 943603718, 177116725,
+	258592864, 460314150, 26192708, 805659331, 322058077, 176035326,
+	569494856, 974786564, 342420684, 333389668, 385521914, 399123930,
+	808607552, 891541065, 42887575, 852036305, 470581645, 338476170,
+	161838094, 642619756, 276792218, 384067568, 796057638, 389652106,
+	750197750, 300996091, 630877367, 448283120, 88152386, 490921095,
+	119559150, 898019494, 717960921, 913463688, 201411522, 890893197,
+	655138867, 345427524, 484032130, 102669715, 951960444, 876688669,
+	7300714, 6071311, 32317};
+
+/**
+ * DEFINE_FIXED_INT - define the functions declared by DECLARE_FIXED_INT.
+ * @bits: the width
+ *
+ * Description: every loop runs exactly FIXED<bits>_LIMBS times so the
+ * compiler unrolls the add, sub and mul kernels completely (mul only its
+ * inner loop), no lengths are checked or trimmed. The operands must be below
+ * 2^bits, results are checked against fixed<bits>_limit. The generated
+ * functions are:
+ *
+ * fixed<bits>_add - r = a + b modulo 2^bits, returns 1 if it wrapped around.
+ * fixed<bits>_sub - r = a - b modulo 2^bits, returns 1 if it wrapped around.
+ * fixed<bits>_mul - r = a * b, returns 0, or -1 if the product is 2^bits or
+ * more (r then holds its low limbs).
+ * fixed<bits>_mod - r = a % m, returns 0, or -1 if m is 0 (r is unchanged).
+ * It calls the generic limbs_divrem(), which does check lengths.
+ * fixed<bits>_from_u4b - copy a u4b_array into r, returns 0, or -1 if it is
+ * negative or 2^bits or more (r is unchanged).
+ * fixed<bits>_to_u4b - returns a new normalized u4b_array, NULL on failure.
+ */
+#define DEFINE_FIXED_INT(bits) \
+	uint32_t fixed##bits##_add(fixed##bits *r, const fixed##bits *a, \
+							   const fixed##bits *b) \
+	{ \
+		uint32_t carry = 0, sum = 0; \
+		size_t i = 0; \
+\
+		UNROLL_LIMBS \
+		for (i = 0; i < FIXED##bits##_LIMBS; i++) \
+		{ \
+			sum = a->limbs[i] + b->limbs[i] + carry; \
+			carry = (sum >= MAX_VAL_u4b); \
+			r->limbs[i] = carry ? sum - MAX_VAL_u4b : sum; \
+		} \
+\
+		/*a + b < 2^(bits + 1) never carries out of the limbs.*/ \
+		if (limbs_cmp(r->limbs, fixed##bits##_limit, FIXED##bits##_LIMBS) < 0) \
+			return (0); \
+\
+		limbs_sub_n(r->limbs, r->limbs, fixed##bits##_limit, FIXED##bits##_LIMBS); \
+		return (1); \
+	} \
+\
+	uint32_t fixed##bits##_sub(fixed##bits *r, const fixed##bits *a, \
+							   const fixed##bits *b) \
+	{ \
+		uint32_t borrow = 0, sub = 0; \
+		size_t i = 0; \
+\
+		UNROLL_LIMBS \
+		for (i = 0; i < FIXED##bits##_LIMBS; i++) \
+		{ \
+			sub = b->limbs[i] + borrow; \
+			borrow = (a->limbs[i] < sub); \
+			r->limbs[i] = borrow ? a->limbs[i] + MAX_VAL_u4b - sub \
+								 : a->limbs[i] - sub; \
+		} \
+\
+		/*r wrapped around modulo 10^(9 * limbs), adding 2^bits wraps it back.*/ \
+		if (borrow) \
+			limbs_add_n(r->limbs, r->limbs, fixed##bits##_limit, FIXED##bits##_LIMBS); \
+\
+		return (borrow); \
+	} \
+\
+	int fixed##bits##_mul(fixed##bits *r, const fixed##bits *a, const fixed##bits *b) \
+	{ \
+		uint32_t product[FIXED##bits##_LIMBS * 2] = {0}; \
+		uint64_t byt_mul = 0; \
+		size_t i = 0, j = 0; \
+\
+		for (i = 0; i < FIXED##bits##_LIMBS; i++) \
+		{ \
+			byt_mul = 0; \
+			UNROLL_LIMBS \
+			for (j = 0; j < FIXED##bits##_LIMBS; j++) \
+			{ \
+				byt_mul += (uint64_t)a->limbs[j] * b->limbs[i] + product[i + j]; \
+				product[i + j] = byt_mul % MAX_VAL_u4b; \
+				byt_mul /= MAX_VAL_u4b; \
+			} \
+\
+			product[i + FIXED##bits##_LIMBS] = byt_mul; \
+		} \
+\
+		memcpy(r->limbs, product, sizeof(r->limbs)); \
+		for (i = FIXED##bits##_LIMBS; i < FIXED##bits##_LIMBS * 2; i++) \
+		{ \
+			if (product[i]) \
+				return (-1); \
+		} \
+\
+		return (limbs_cmp(product, fixed##bits##_limit, FIXED##bits##_LIMBS) < 0 ? 0 : -1); \
+	} \
+\
+	int fixed##bits##_mod(fixed##bits *r, const fixed##bits *a, const fixed##bits *m) \
+	{ \
+		uint32_t remainder[FIXED##bits##_LIMBS] = {0}; \
+		uint32_t scratch[FIXED##bits##_LIMBS * 2 + 1] = {0}; \
+		size_t a_len = FIXED##bits##_LIMBS, m_len = FIXED##bits##_LIMBS; \
+\
+		while (m_len && !m->limbs[m_len - 1]) \
+			m_len--; \
+\
+		if (!m_len) \
+			return (-1); \
+\
+		while (a_len && !a->limbs[a_len - 1]) \
+			a_len--; \
+\
+		if (a_len < m_len) \
+		{ \
+			*r = *a; \
+			return (0); \
+		} \
+\
+		limbs_divrem(NULL, remainder, a->limbs, a_len, m->limbs, m_len, scratch); \
+		memcpy(r->limbs, remainder, sizeof(r->limbs)); \
+		return (0); \
+	} \
+\
+	int fixed##bits##_from_u4b(fixed##bits *r, const u4b_array *arr) \
+	{ \
+		u4b_array view = slice_u4b_array(arr, 0, arr->len); \
+\
+		trim_u4b_array(&view); \
+		if (view.is_negative || view.len > FIXED##bits##_LIMBS || \
+			(view.len == FIXED##bits##_LIMBS && \
+			 limbs_cmp(view.array, fixed##bits##_limit, FIXED##bits##_LIMBS) >= 0)) \
+			return (-1); \
+\
+		memset(r->limbs, 0, sizeof(r->limbs)); \
+		if (view.len) \
+			memcpy(r->limbs, view.array, sizeof(*view.array) * view.len); \
+\
+		return (0); \
+	} \
+\
+	u4b_array *fixed##bits##_to_u4b(const fixed##bits *n) \
+	{ \
+		u4b_array *arr = alloc_u4b_array(FIXED##bits##_LIMBS); \
+\
+		if (!arr) \
+			return (NULL); \
+\
+		memcpy(arr->array, n->limbs, sizeof(n->limbs)); \
+		trim_u4b_array(arr); \
+		ASSERT_NORMALIZED(arr); \
+		return (arr); \
+	}
+
+DEFINE_FIXED_INT(256)
+DEFINE_FIXED_INT(512)
+DEFINE_FIXED_INT(1024)
+DEFINE_FIXED_INT(2048)
@@ -5,14 +5,18 @@
 #define _GNU_SOURCE /*program_invocation_name*/
 #endif
 
+#include <assert.h>
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <inttypes.h>
 #include <ctype.h>
 #include <errno.h>
 #include <math.h> /*pow(), Need to link with -lm*/
+#include <stdatomic.h>
+#include <stddef.h>
 
 #define ATTR_MALLOC
 #define ATTR_MALLOC_FREE(...)
@@ -57,19 +61,343 @@
 /*Negative bit toggle for uint32_t types.*/
 #define NEGBIT_u4b (1 << 30)
 
+/*128 bit integers are a GNU extension, used for the small number fast path.*/
+#if defined __SIZEOF_INT128__
+#define INFIX_HAS_INT128
+__extension__ typedef __int128 int128_t;
+#endif
+
+/*Owned limb buffers start on a boundary of this many bytes (a cache line).*/
+#define LIMB_ALIGNMENT (64)
+/*The capacity of owned limb buffers is a multiple of this many limbs.*/
+#define LIMB_PADDING (LIMB_ALIGNMENT / sizeof(uint32_t))
+
+/*Smallest chunk limbs_mul() cuts a long operand into for schoolbook.*/
+#define MUL_CHUNK_LIMBS (256)
+
+/*Karatsuba multiplication is used for operands of at least this many limbs.*/
+#define KARATSUBA_LIMBS (16)
+
+/*Sparse multiplication is used when it is estimated to cost at most 1 in*/
+/*this many of the limb products limbs_mul() does (see limbs_mul_cost()).*/
+#define SPARSE_MUL_RATIO (2)
+/*Each run of nonzero limbs costs limbs_mul_sparse() about as much as this*/
+/*many limb products, for the call and the carry after it.*/
+#define SPARSE_RUN_COST (4)
+/*Extra low limbs computed by a short product (see limbs_mul_high()), its*/
+/*error is less than 1 in the last of them.*/
+#define MUL_HIGH_GUARD_LIMBS (3)
+/*A short product is used when it has at most 1 in this many of the limb*/
+/*products limbs_mul() does (see limbs_mul_cost()), its passes are slower.*/
+#define MUL_HIGH_RATIO (2)
+/*Rationals are only reduced once their numerator and denominator together*/
+/*have more limbs than this, or when they are printed.*/
+#define RATIONAL_REDUCE_LIMBS (16)
+/*Zero gaps shorter than this many limbs are kept inside a run of a*/
+/*sparse_u4b, a limb_run costs as much memory as 4 limbs.*/
+#define SPARSE_MIN_GAP (4)
+/*Numbers of up to this many limbs are converted to and from other bases*/
+/*one chunk at a time, longer ones are split in halves.*/
+#define RADIX_DC_LIMBS (32)
+/*Most powers cached per base, chunk^(2^63) would not fit in memory anyway.*/
+#define RADIX_MAX_POWERS (64)
+/*Base of the 16 bit digits the binary form of a number is converted with.*/
+#define RADIX_WORD_BASE (1 << 16)
+
+/*Output modes of format_intarr(), see struct output_format.*/
+#define OUTPUT_FULL (0)
+#define OUTPUT_DIGIT_COUNT (1)
+#define OUTPUT_FIRST_DIGITS (2)
+#define OUTPUT_LAST_DIGITS (3)
+#define OUTPUT_SCIENTIFIC (4)
+
+/*Check that a u4b_array is normalized, compiled out with NDEBUG (release).*/
+#ifdef NDEBUG
+#define ASSERT_NORMALIZED(arr) ((void)0)
+#else
+#define ASSERT_NORMALIZED(arr) assert(is_normalized_u4b_array(arr))
+#endif
+
 /**
  * struct uint32_t_array_attributes - an array of unsigned 4 byte ints
  * @len: number of items in the array
+ * @capacity: number of items allocated for the array, 0 if the array is not
+ * owned by this struct (e.g. a stack array). Owned arrays are reference
+ * counted and shared copy-on-write between duplicates.
  * @is_negative: flag for signedness of number
  * @array: pointer to an array of 4 byte ints
+ *
+ * Description: a u4b_array with a capacity of 0 is a view, see
+ * slice_u4b_array(). Views can be passed to any function that only reads its
+ * inputs, they are never freed or written to (used as a destination they are
+ * first copied into an owned buffer).
+ * Owned buffers are LIMB_ALIGNMENT aligned, their capacity is a multiple of
+ * LIMB_PADDING and the items from len up to capacity are always zero. Vector
+ * kernels can therefore read whole vectors without a scalar prologue or
+ * epilogue and never go out of bounds.
+ * A u4b_array is normalized when it has no leading zero limbs and zero is not
+ * negative, see is_normalized_u4b_array(). Every arithmetic function returns
+ * normalized arrays, so only hand-built inputs ever need trimming.
  */
 typedef struct uint32_t_array_attributes
 {
 	size_t len;
+	size_t capacity;
 	char is_negative;
 	uint32_t *array;
 } u4b_array;
 
+/**
+ * struct allocator_hooks - functions used for all of the library's memory
+ * @alloc: allocate size bytes, NULL on failure
+ * @realloc: resize a block from alloc, NULL on failure (the block is untouched)
+ * @free: free a block from alloc or realloc, ptr may be NULL
+ * @ctx: passed as the last argument to every hook (e.g. an arena)
+ *
+ * Description: see set_allocator_hooks() and set_thread_allocator_hooks().
+ */
+typedef struct allocator_hooks
+{
+	void *(*alloc)(size_t size, void *ctx);
+	void *(*realloc)(void *ptr, size_t size, void *ctx);
+	void (*free)(void *ptr, void *ctx);
+	void *ctx;
+} allocator_hooks;
+
+/**
+ * struct limb_header - bookkeeping stored in front of an owned u4b_array buffer
+ * @refs: number of u4b_arrays sharing the buffer
+ * @hooks: the allocator the buffer came from, it is also resized and freed
+ * with it
+ * @block: start of the allocated block, the limbs are aligned within it
+ */
+typedef struct limb_header
+{
+	atomic_size_t refs;
+	const allocator_hooks *hooks;
+	void *block;
+} limb_header;
+
+/*Ask the compiler to fully unroll a loop with a constant trip count.*/
+#if defined __clang__
+#define UNROLL_LIMBS _Pragma("unroll")
+#elif defined __GNUC__
+#define UNROLL_LIMBS _Pragma("GCC unroll 128")
+#else
+#define UNROLL_LIMBS
+#endif
+
+/*Limbs in each fixed width integer, enough to hold any number below 2^bits.*/
+#define FIXED256_LIMBS (9)	 /*2^256 has 78 digits.*/
+#define FIXED512_LIMBS (18)	 /*2^512 has 155 digits.*/
+#define FIXED1024_LIMBS (35) /*2^1024 has 309 digits.*/
+#define FIXED2048_LIMBS (69) /*2^2048 has 617 digits.*/
+
+/**
+ * DECLARE_FIXED_INT - declare a fixed width unsigned integer and its functions
+ * @bits: the width, FIXED<bits>_LIMBS must be defined
+ *
+ * Description: a fixed<bits> is a struct holding exactly FIXED<bits>_LIMBS
+ * base 10^9 limbs (little endian) so it can live on the stack and be copied
+ * by assignment. Unused high limbs are zero. It holds numbers below 2^bits:
+ * addition and subtraction wrap around modulo 2^bits and report it, products
+ * and conversions of 2^bits or more are errors. fixed<bits>_mod() is not an
+ * unrolled kernel, it calls limbs_divrem(). The functions are defined in
+ * fixed_int.c by DEFINE_FIXED_INT and the result may be the same as either
+ * operand.
+ */
+#define DECLARE_FIXED_INT(bits) \
+	typedef struct fixed##bits \
+	{ \
+		uint32_t limbs[FIXED##bits##_LIMBS]; \
+	} fixed##bits; \
+\
+	uint32_t fixed##bits##_add(fixed##bits *r, const fixed##bits *a, \
+							   const fixed##bits *b); \
+	uint32_t fixed##bits##_sub(fixed##bits *r, const fixed##bits *a, \
+							   const fixed##bits *b); \
+	int fixed##bits##_mul(fixed##bits *r, const fixed##bits *a, const fixed##bits *b); \
+	int fixed##bits##_mod(fixed##bits *r, const fixed##bits *a, const fixed##bits *m); \
+	int fixed##bits##_from_u4b(fixed##bits *r, const u4b_array *arr); \
+	u4b_array *fixed##bits##_to_u4b(const fixed##bits *n)
+
+/**
+ * struct infiX_divisor - a denominator prepared for repeated division
+ * @den: the trimmed denominator, used for the signs of the results
+ * @zeros: number of low zero limbs in den, they are not in @limbs
+ * @limbs: the magnitude of den without its low zero limbs multiplied by @scale
+ * @len: number of limbs in limbs
+ * @scale: MAX_VAL_u4b / (top limb of den + 1), makes limbs' top limb at least
+ * MAX_VAL_u4b / 2, 1 for single limb denominators
+ * @inverse: limbs_invert_limb() of the top limb of limbs
+ *
+ * Description: see infiX_divisor_new() and infiX_divmod_by().
+ */
+typedef struct infiX_divisor
+{
+	u4b_array *den;
+	size_t zeros;
+	uint32_t *limbs;
+	size_t len;
+	uint32_t scale;
+	uint64_t inverse;
+} infiX_divisor;
+
+/**
+ * struct residue_table - moduli prepared for infiX_residues()
+ * @count: number of moduli
+ * @moduli: the moduli, none of them zero
+ * @inverses: limbs_invert_limb() of each modulus
+ */
+typedef struct residue_table
+{
+	size_t count;
+	uint32_t *moduli;
+	uint64_t *inverses;
+} residue_table;
+
+/**
+ * struct limb_run - a run of limbs in a sparse_u4b
+ * @offset: index of the run's first limb in the dense number
+ * @len: number of limbs in the run
+ */
+typedef struct limb_run
+{
+	size_t offset;
+	size_t len;
+} limb_run;
+
+/**
+ * struct sparse_u4b_attributes - a run length compressed u4b_array
+ * @len: number of limbs in the dense number, 0 for zero
+ * @is_negative: flag for signedness of number, 0 for zero
+ * @nruns: number of runs
+ * @runs_capacity: number of runs allocated
+ * @runs: the runs, in increasing order of offset
+ * @nlimbs: number of limbs in all runs
+ * @limbs_capacity: number of limbs allocated
+ * @limbs: the limbs of every run, one after the other
+ *
+ * Description: the runs of zero limbs between the runs are not stored, only
+ * gaps shorter than SPARSE_MIN_GAP are. The first and last limb of every run
+ * is nonzero, so the last run ends at len. See sparse_from_u4b() and
+ * sparse_to_u4b().
+ */
+typedef struct sparse_u4b_attributes
+{
+	size_t len;
+	char is_negative;
+	size_t nruns;
+	size_t runs_capacity;
+	limb_run *runs;
+	size_t nlimbs;
+	size_t limbs_capacity;
+	uint32_t *limbs;
+} sparse_u4b;
+
+/**
+ * struct infiX_decimal - a fixed point decimal number
+ * @mantissa: the number without its decimal point, normalized
+ * @scale: number of decimal places, the value is mantissa / 10^scale
+ *
+ * Description: see decimal_from_str() and decimal_multiplication().
+ */
+typedef struct infiX_decimal
+{
+	u4b_array *mantissa;
+	size_t scale;
+} infiX_decimal;
+
+/**
+ * struct infiX_float - an arbitrary precision floating point number
+ * @mantissa: the significant limbs with the sign, normalized and without low
+ * zero limbs
+ * @exponent: the value is mantissa * MAX_VAL_u4b^exponent
+ * @precision: most limbs the mantissa may have, every operation truncates its
+ * result to this
+ *
+ * Description: see float_from_decimal() and float_addition().
+ */
+typedef struct infiX_float
+{
+	u4b_array *mantissa;
+	ssize_t exponent;
+	size_t precision;
+} infiX_float;
+
+/**
+ * struct infiX_rational - an exact fraction
+ * @num: the numerator, it holds the sign
+ * @den: the denominator, positive
+ * @is_reduced: 1 if num and den are known to have no common factor
+ *
+ * Description: the fraction is not kept in lowest terms, see
+ * rational_reduce().
+ */
+typedef struct infiX_rational
+{
+	u4b_array *num;
+	u4b_array *den;
+	char is_reduced;
+} infiX_rational;
+
+/**
+ * struct radix_powers - the powers of a base used by the radix conversions
+ * @digits: number of digits of the base in a chunk, the most whose value
+ * stays below MAX_VAL_u4b
+ * @chunk: base^digits
+ * @count: number of powers computed so far
+ * @powers: powers[j] is chunk^(2^j)
+ * @inverses: inverses[j] is MAX_VAL_u4b^(2 * m) / powers[j] (floored) where m
+ * is the number of limbs of powers[j], NULL until it is first needed
+ *
+ * Description: see radix_to_intarray() and free_radix_powers().
+ */
+typedef struct radix_powers
+{
+	size_t digits;
+	uint32_t chunk;
+	size_t count;
+	u4b_array *powers[RADIX_MAX_POWERS];
+	u4b_array *inverses[RADIX_MAX_POWERS];
+} radix_powers;
+
+/**
+ * struct infiX_bits - the binary form of a number for bitwise operations
+ * @len: number of words, 0 for zero
+ * @is_negative: flag for signedness of number, 0 for zero
+ * @words: the magnitude in base 2^32 words (little endian), the top word is
+ * not zero
+ *
+ * Description: the operations treat negative numbers as two's complement
+ * with infinitely many leading ones, so -1 & n is n and -1 >> 1 is -1. A
+ * number is converted once by bits_from_u4b() and any number of operations
+ * can then be done on its binary form, see bits_and().
+ */
+typedef struct infiX_bits
+{
+	size_t len;
+	char is_negative;
+	uint32_t *words;
+} infiX_bits;
+
+/**
+ * struct output_format - how an answer is written
+ * @mode: OUTPUT_FULL for every digit, OUTPUT_DIGIT_COUNT for the number of
+ * digits, OUTPUT_FIRST_DIGITS or OUTPUT_LAST_DIGITS for some of the digits
+ * and OUTPUT_SCIENTIFIC for [-]d.ddde+N
+ * @digits: number of digits for OUTPUT_FIRST_DIGITS and OUTPUT_LAST_DIGITS,
+ * digits after the point for OUTPUT_SCIENTIFIC
+ *
+ * Description: see format_intarr(). Only OUTPUT_FULL writes the whole
+ * number, the other modes read a few limbs at either end.
+ */
+typedef struct output_format
+{
+	int mode;
+	size_t digits;
+} output_format;
+
 /**
  * struct string_attributes - holds details about a string of characters
  * @str: the number string
@@ -88,7 +416,7 @@ typedef struct string_attributes
 /**
  * math_function - generic prototype for basic arithmetic functions.
  */
-typedef u4b_array *math_function(u4b_array *, u4b_array *);
+typedef u4b_array *math_function(const u4b_array *, const u4b_array *);
 
 /**
  * struct operator_function - holds an operator symbol and it's function
@@ -101,14 +429,24 @@ typedef struct operator_function
 	math_function *f;
 } op_func;
 
-char *infiX_manager(char *num1, char *op_symbol, char *num2);
+char *infiX_manager(char *num1, char *op_symbol, char *num2,
+				   const output_format *format);
 void panic(const char *err_type);
+void panic_digit(char digit, unsigned int base);
 void help_me(const char *which_help);
 
 /*mem_funcs*/
+const allocator_hooks *set_allocator_hooks(const allocator_hooks *hooks);
+const allocator_hooks *set_thread_allocator_hooks(const allocator_hooks *hooks);
 void *free_n_null(void *ptr);
 void *free_u4b_array(u4b_array *arr);
 u4b_array *alloc_u4b_array(size_t len);
+u4b_array *dup_u4b_array(const u4b_array *arr);
+int is_shared_u4b_array(const u4b_array *arr);
+int unshare_u4b_array(u4b_array *arr);
+int reserve_u4b_array(u4b_array *arr, size_t capacity);
+int resize_u4b_array(u4b_array *arr, size_t len);
+u4b_array *move_u4b_array(u4b_array *dest, u4b_array *src);
 
 ATTR_MALLOC_FREE(free_n_null)
 ATTR_ALLOC_SIZE(1, 2)
@@ -118,23 +456,162 @@ ATTR_MALLOC_FREE(free_n_null)
 ATTR_ALLOC_SIZE(1)
 void *xmalloc(size_t size);
 
+ATTR_ALLOC_SIZE(2)
+void *xrealloc(void *ptr, size_t size);
+
 /*string_funcs*/
 str_array *parse_numstr(const char *numstr);
-uint32_t *str_to_intarray(const char *num_str);
-char *intarr_to_str(uint32_t *u32array);
+u4b_array *str_to_intarray(const char *num_str);
+char *intarr_to_str(const u4b_array *arr);
 size_t padding_chars_len(char *str, char *ch);
+int misplaced_underscore(const char *str, size_t len);
+
+/*infiX_digits*/
+size_t intarr_digit_count(const u4b_array *arr);
+char *intarr_first_digits(const u4b_array *arr, size_t k);
+char *intarr_last_digits(const u4b_array *arr, size_t k);
+char *intarr_to_sci_str(const u4b_array *arr, size_t precision);
+char *format_intarr(const u4b_array *arr, const output_format *format);
 
 /*array_funcs*/
 void trim_u4b_array(u4b_array *arr);
-void print_u4b_array(u4b_array *arr);
-ssize_t cmp_u4barray(u4b_array *arr1, u4b_array *arr2);
-ssize_t cmp_rev_uint32array(uint32_t *arr1, uint32_t *arr2, size_t len);
+int is_normalized_u4b_array(const u4b_array *arr);
+u4b_array slice_u4b_array(const u4b_array *arr, size_t start, size_t len);
+void print_u4b_array(const u4b_array *arr);
+ssize_t cmp_u4barray(const u4b_array *arr1, const u4b_array *arr2);
+ssize_t cmp_rev_uint32array(const uint32_t *arr1, const uint32_t *arr2, size_t len);
+
+/*limb_funcs*/
+uint32_t limbs_add_n(uint32_t *rp, const uint32_t *up, const uint32_t *vp, size_t n);
+uint32_t limbs_add(uint32_t *rp, const uint32_t *up, size_t un,
+				   const uint32_t *vp, size_t vn);
+uint32_t limbs_sub_n(uint32_t *rp, const uint32_t *up, const uint32_t *vp, size_t n);
+uint32_t limbs_sub(uint32_t *rp, const uint32_t *up, size_t un,
+				   const uint32_t *vp, size_t vn);
+uint32_t limbs_mul_1(uint32_t *rp, const uint32_t *up, size_t n, uint32_t v);
+uint32_t limbs_addmul_1(uint32_t *rp, const uint32_t *up, size_t n, uint32_t v);
+uint32_t limbs_submul_1(uint32_t *rp, const uint32_t *up, size_t n, uint32_t v);
+uint32_t limbs_divrem_1(uint32_t *qp, const uint32_t *up, size_t n, uint32_t v);
+void limbs_lshift(uint32_t *rp, const uint32_t *up, size_t n, size_t shift);
+void limbs_rshift(uint32_t *rp, const uint32_t *up, size_t n, size_t shift);
+int limbs_cmp(const uint32_t *up, const uint32_t *vp, size_t n);
+size_t limbs_mul_itch(size_t un, size_t vn);
+void limbs_mul(uint32_t *rp, const uint32_t *up, size_t un,
+			   const uint32_t *vp, size_t vn, uint32_t *scratch);
+size_t limbs_mul_cost(size_t un, size_t vn);
+size_t limbs_mul_n_itch(size_t n);
+void limbs_mul_n(uint32_t *rp, const uint32_t *up, const uint32_t *vp,
+				 size_t n, uint32_t *scratch);
+uint64_t limbs_invert_limb(uint32_t d);
+uint32_t limbs_divrem_1_preinv(uint32_t *qp, const uint32_t *up, size_t n,
+							   uint32_t v, uint64_t inverse);
+size_t limbs_runs(size_t *runs, const uint32_t *up, size_t un, size_t *nonzero);
+void limbs_mul_sparse(uint32_t *rp, const uint32_t *up, size_t un,
+					  const size_t *runs, size_t nruns,
+					  const uint32_t *vp, size_t vn);
+int limbs_mul_sparse_wins(size_t un, size_t u_nonzero, size_t u_runs,
+						  size_t vn, size_t v_nonzero);
+void limbs_mul_high(uint32_t *rp, const uint32_t *up, size_t un,
+					const uint32_t *vp, size_t vn, size_t skip);
+int limbs_mul_high_wins(size_t un, size_t vn, size_t skip);
+size_t limbs_divrem_itch(size_t nn, size_t dn);
+void limbs_divrem(uint32_t *qp, uint32_t *rp, const uint32_t *np, size_t nn,
+				  const uint32_t *dp, size_t dn, uint32_t *scratch);
+void limbs_mod_1s(uint32_t *rp, const uint32_t *up, size_t n,
+				  const uint32_t *moduli, const uint64_t *inverses, size_t count);
+size_t limbs_divexact_itch(size_t nn, size_t dn);
+void limbs_divexact(uint32_t *qp, const uint32_t *np, size_t nn,
+					const uint32_t *dp, size_t dn, uint32_t *scratch);
+void limbs_divrem_preinv(uint32_t *qp, uint32_t *rp, const uint32_t *np,
+						 size_t nn, const uint32_t *dp, size_t dn,
+						 uint32_t scale, uint64_t inverse, uint32_t *scratch);
+
+/*fixed_int*/
+DECLARE_FIXED_INT(256);
+DECLARE_FIXED_INT(512);
+DECLARE_FIXED_INT(1024);
+DECLARE_FIXED_INT(2048);
 
 /*math_funcs*/
-u4b_array *infiX_division(u4b_array *n1, u4b_array *n2);
-u4b_array *infiX_modulus(u4b_array *n1, u4b_array *n2);
-u4b_array *infiX_subtraction(u4b_array *n1, u4b_array *n2);
-u4b_array *infiX_multiplication(u4b_array *n1, u4b_array *n2);
-u4b_array *infiX_addition(u4b_array *n1, u4b_array *n2);
+u4b_array *infiX_division(const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_modulus(const u4b_array *n1, const u4b_array *n2);
+int infiX_divmod(const u4b_array *n1, const u4b_array *n2, u4b_array **quotient, u4b_array **remainder);
+infiX_divisor *infiX_divisor_new(const u4b_array *den);
+void *free_infiX_divisor(infiX_divisor *d);
+u4b_array *infiX_division_by(const u4b_array *n1, const infiX_divisor *d);
+u4b_array *infiX_modulus_by(const u4b_array *n1, const infiX_divisor *d);
+u4b_array *infiX_divexact(const u4b_array *n1, const u4b_array *n2);
+int infiX_divmod_by(const u4b_array *n1, const infiX_divisor *d, u4b_array **quotient, u4b_array **remainder);
+u4b_array *infiX_subtraction(const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_multiplication(const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_addition(const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_addition_into(u4b_array *dest, const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_subtraction_into(u4b_array *dest, const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_multiplication_into(u4b_array *dest, const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_multiplication_high(const u4b_array *n1, const u4b_array *n2, size_t limbs);
+u4b_array *infiX_shift_left(const u4b_array *n, size_t digits);
+u4b_array *infiX_shift_left_into(u4b_array *dest, const u4b_array *n, size_t digits);
+u4b_array *infiX_shift_right(const u4b_array *n, size_t digits);
+u4b_array *infiX_shift_right_into(u4b_array *dest, const u4b_array *n, size_t digits);
+int infiX_residue(const u4b_array *n, uint32_t modulus, uint32_t *residue);
+residue_table *residue_table_new(const uint32_t *moduli, size_t count);
+void *free_residue_table(residue_table *table);
+int infiX_residues(const u4b_array *n, const residue_table *table, uint32_t *residues);
+int small_from_str(const char *num_str, int64_t *value);
+infiX_decimal *decimal_new(const u4b_array *mantissa, size_t scale);
+infiX_decimal *decimal_from_str(const char *num_str);
+char *decimal_to_str(const infiX_decimal *n);
+void *free_infiX_decimal(infiX_decimal *n);
+infiX_decimal *decimal_addition(const infiX_decimal *n1, const infiX_decimal *n2, size_t places);
+infiX_decimal *decimal_subtraction(const infiX_decimal *n1, const infiX_decimal *n2, size_t places);
+infiX_decimal *decimal_multiplication(const infiX_decimal *n1, const infiX_decimal *n2, size_t places);
+infiX_decimal *decimal_division(const infiX_decimal *n1, const infiX_decimal *n2, size_t places);
+infiX_float *float_from_decimal(const infiX_decimal *n, size_t precision);
+infiX_decimal *float_to_decimal(const infiX_float *n);
+void *free_infiX_float(infiX_float *n);
+infiX_float *float_addition(const infiX_float *n1, const infiX_float *n2, size_t precision);
+infiX_float *float_subtraction(const infiX_float *n1, const infiX_float *n2, size_t precision);
+infiX_float *float_multiplication(const infiX_float *n1, const infiX_float *n2, size_t precision);
+infiX_float *float_division(const infiX_float *n1, const infiX_float *n2, size_t precision);
+infiX_float *float_sqrt(const infiX_float *n, size_t precision);
+u4b_array *infiX_gcd(const u4b_array *n1, const u4b_array *n2);
+infiX_rational *rational_new(const u4b_array *num, const u4b_array *den);
+infiX_rational *rational_from_str(const char *num_str);
+char *rational_to_str(infiX_rational *n);
+void *free_infiX_rational(infiX_rational *n);
+int rational_reduce(infiX_rational *n);
+ssize_t cmp_rational(const infiX_rational *n1, const infiX_rational *n2);
+infiX_rational *rational_addition(const infiX_rational *n1, const infiX_rational *n2);
+infiX_rational *rational_subtraction(const infiX_rational *n1, const infiX_rational *n2);
+infiX_rational *rational_multiplication(const infiX_rational *n1, const infiX_rational *n2);
+infiX_rational *rational_division(const infiX_rational *n1, const infiX_rational *n2);
+sparse_u4b *sparse_from_u4b(const u4b_array *arr);
+u4b_array *sparse_to_u4b(const sparse_u4b *n);
+void *free_sparse_u4b(sparse_u4b *n);
+ssize_t cmp_sparse_u4b(const sparse_u4b *n1, const sparse_u4b *n2);
+sparse_u4b *sparse_addition(const sparse_u4b *n1, const sparse_u4b *n2);
+sparse_u4b *sparse_subtraction(const sparse_u4b *n1, const sparse_u4b *n2);
+sparse_u4b *sparse_dense_op(math_function *f, const sparse_u4b *n1, const sparse_u4b *n2);
+u4b_array *radix_digits_to_intarray(const uint16_t *digits, size_t len, unsigned int base);
+uint16_t *intarr_to_radix_digits(const u4b_array *arr, unsigned int base, size_t *len);
+u4b_array *radix_to_intarray(const char *num_str, unsigned int base);
+char *intarr_to_radix(const u4b_array *arr, unsigned int base);
+void free_radix_powers(void);
+infiX_bits *bits_from_u4b(const u4b_array *n);
+u4b_array *bits_to_u4b(const infiX_bits *n);
+void *free_infiX_bits(infiX_bits *n);
+infiX_bits *bits_and(const infiX_bits *n1, const infiX_bits *n2);
+infiX_bits *bits_or(const infiX_bits *n1, const infiX_bits *n2);
+infiX_bits *bits_xor(const infiX_bits *n1, const infiX_bits *n2);
+infiX_bits *bits_not(const infiX_bits *n);
+infiX_bits *bits_shift_left(const infiX_bits *n, size_t shift);
+infiX_bits *bits_shift_right(const infiX_bits *n, size_t shift);
+u4b_array *infiX_and(const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_or(const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_xor(const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_not(const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_lshift(const u4b_array *n1, const u4b_array *n2);
+u4b_array *infiX_rshift(const u4b_array *n1, const u4b_array *n2);
+char *infiX_small(const char *num1, const char *op_symbol, const char *num2);
 
 #endif /* !INFIX_H */
@@ -1,7 +1,7 @@
 #include "infiX.h"
 
-static u4b_array *add_negatives(u4b_array *n1, u4b_array *n2)
-	ATTR_NONNULL;
+static u4b_array *add_negatives(u4b_array *dest, u4b_array *n1, u4b_array *n2)
+	ATTR_NONNULL_IDX(2, 3);
 
 /**
  * infiX_addition - adds integers stored in arrays
@@ -10,57 +10,78 @@ static u4b_array *add_negatives(u4b_array *n1, u4b_array *n2)
  *
  * Return: pointer to result, NULL on failure
  */
-u4b_array *infiX_addition(u4b_array *n1, u4b_array *n2)
+u4b_array *infiX_addition(const u4b_array *n1, const u4b_array *n2)
 {
-	size_t n1_i = 0, n2_i = 0, sum_i = 0, result_len = 0;
-	int64_t byt_sum = 0;
-	u4b_array *sum = NULL;
+	return (infiX_addition_into(NULL, n1, n2));
+}
+
+/**
+ * infiX_addition_into - adds integers stored in arrays into a given array
+ * @dest: array to store the result in, NULL to allocate a new one
+ * @n1: the first integer array (base 10)
+ * @n2: the second integer array (base 10)
+ *
+ * Description: dest's buffer is reused if it has enough capacity, it may be
+ * the same struct as n1 or n2 for in-place accumulation. n1 and n2 are only
+ * read through views, so they are never modified (unless one is dest).
+ *
+ * Return: pointer to result, NULL on failure
+ */
+u4b_array *infiX_addition_into(u4b_array *dest, const u4b_array *n1, const u4b_array *n2)
+{
+	size_t result_len = 0;
+	u4b_array *sum = dest, a = {0}, b = {0}, tmp = {0};
 
 	if (!n1 || !n2)
 		return (NULL);
 
-	trim_u4b_array(n1);
-	trim_u4b_array(n2);
-	if (n1->is_negative || n2->is_negative)
-		return (add_negatives(n1, n2));
-
 	/*sum->len = (larger of n1->len or n2->len, +1 for a carry)*/
 	result_len = ((n1->len > n2->len) ? n1->len : n2->len) + 1;
-	if (result_len <= 1)
-		return (alloc_u4b_array(0));
+	/*Grow dest before viewing the inputs, in case it is one of them.*/
+	if (dest && reserve_u4b_array(dest, result_len))
+		return (NULL);
 
-	sum = alloc_u4b_array(result_len);
-	while (sum && (n1_i < n1->len || n2_i < n2->len || byt_sum > 0))
+	a = slice_u4b_array(n1, 0, n1->len);
+	b = slice_u4b_array(n2, 0, n2->len);
+	trim_u4b_array(&a);
+	trim_u4b_array(&b);
+	if (a.is_negative || b.is_negative)
+		return (add_negatives(dest, &a, &b));
+
+	if (a.len < b.len)
 	{
-		if (n1_i < n1->len)
-		{
-			byt_sum += n1->array[n1_i];
-			++n1_i;
-		}
+		tmp = a;
+		a = b;
+		b = tmp;
+	}
 
-		if (n2_i < n2->len)
-		{
-			byt_sum += n2->array[n2_i];
-			++n2_i;
-		}
+	result_len = a.len ? a.len + 1 : 0;
+	if (!sum)
+		sum = alloc_u4b_array(result_len);
+	else if (resize_u4b_array(sum, result_len))
+		return (NULL);
 
-		sum->array[sum_i] = byt_sum % (MAX_VAL_u4b);
-		byt_sum /= (MAX_VAL_u4b);
-		++sum_i;
-	}
+	if (!sum)
+		return (NULL);
+
+	sum->is_negative = 0;
+	if (result_len)
+		sum->array[a.len] = limbs_add(sum->array, a.array, a.len, b.array, b.len);
 
 	trim_u4b_array(sum);
+	ASSERT_NORMALIZED(sum);
 	return (sum);
 }
 
 /**
  * add_negatives - handle addition of signed/negative numbers
- * @n1: first number
- * @n2: second number
+ * @dest: array to store the result in, NULL to allocate a new one
+ * @n1: view of the first number, its sign is changed
+ * @n2: view of the second number, its sign is changed
  *
  * Return: return results of operation
  */
-u4b_array *add_negatives(u4b_array *n1, u4b_array *n2)
+u4b_array *add_negatives(u4b_array *dest, u4b_array *n1, u4b_array *n2)
 {
 	u4b_array *result = NULL;
 
@@ -69,9 +90,7 @@ u4b_array *add_negatives(u4b_array *n1, u4b_array *n2)
 		/*-8 + -7 = -(8+7)*/
 		n1->is_negative = 0;
 		n2->is_negative = 0;
-		result = infiX_addition(n1, n2);
-		n1->is_negative = 1;
-		n2->is_negative = 1;
+		result = infiX_addition_into(dest, n1, n2);
 		if (result)
 			result->is_negative = 1;
 	}
@@ -79,15 +98,13 @@ u4b_array *add_negatives(u4b_array *n1, u4b_array *n2)
 	{
 		/*-8 + 7 = 7-8*/
 		n1->is_negative = 0;
-		result = infiX_subtraction(n2, n1);
-		n1->is_negative = 1;
+		result = infiX_subtraction_into(dest, n2, n1);
 	}
 	else if (n2->is_negative)
 	{
 		/*8 + -7 = 8-7*/
 		n2->is_negative = 0;
-		result = infiX_subtraction(n1, n2);
-		n2->is_negative = 1;
+		result = infiX_subtraction_into(dest, n1, n2);
 	}
 
 	return (result);
@@ -0,0 +1,562 @@
+#include "infiX.h"
+
+static infiX_bits *alloc_bits(size_t len);
+static void trim_bits(infiX_bits *n) ATTR_NONNULL;
+static uint32_t add_one(uint32_t *words, size_t len) ATTR_NONNULL;
+static void to_twos(uint32_t *words, size_t len, const infiX_bits *n) ATTR_NONNULL;
+static infiX_bits *from_twos(uint32_t *words, size_t len) ATTR_NONNULL;
+static infiX_bits *bitwise(const infiX_bits *n1, const infiX_bits *n2, char op)
+	ATTR_NONNULL;
+static int shift_count(const u4b_array *n, size_t *shift) ATTR_NONNULL;
+static u4b_array *bits_op(const u4b_array *n1, const u4b_array *n2, char op);
+
+/**
+ * alloc_bits - allocate a binary number of zero words.
+ * @len: number of words
+ *
+ * Return: the number, NULL on failure
+ */
+infiX_bits *alloc_bits(size_t len)
+{
+	infiX_bits *n = xcalloc(1, sizeof(*n));
+
+	if (!n)
+		return (NULL);
+
+	n->words = xcalloc(len ? len : 1, sizeof(*n->words));
+	if (!n->words)
+		return (free_n_null(n));
+
+	n->len = len;
+	return (n);
+}
+
+/**
+ * trim_bits - drop the leading zero words of a binary number.
+ * @n: the number
+ */
+void trim_bits(infiX_bits *n)
+{
+	while (n->len && !n->words[n->len - 1])
+		n->len--;
+
+	if (!n->len)
+		n->is_negative = 0;
+}
+
+/**
+ * add_one - add 1 to a word vector.
+ * @words: the vector
+ * @len: number of words in it
+ *
+ * Return: the carry out of the top word.
+ */
+uint32_t add_one(uint32_t *words, size_t len)
+{
+	size_t i = 0;
+
+	for (i = 0; i < len; i++)
+		if (++words[i])
+			return (0);
+
+	return (1);
+}
+
+/**
+ * to_twos - write a binary number in two's complement.
+ * @words: where to write the len words
+ * @len: number of words, more than n->len so the sign bit fits
+ * @n: the number
+ *
+ * Description: -m is ~(m - 1), the words above n's are its sign extension.
+ */
+void to_twos(uint32_t *words, size_t len, const infiX_bits *n)
+{
+	uint32_t borrow = n->is_negative, w = 0;
+	size_t i = 0;
+
+	for (i = 0; i < len; i++)
+	{
+		w = i < n->len ? n->words[i] : 0;
+		if (n->is_negative)
+		{
+			words[i] = ~(w - borrow);
+			borrow = (w < borrow);
+		}
+		else
+			words[i] = w;
+	}
+}
+
+/**
+ * from_twos - make a binary number from words in two's complement.
+ * @words: the words, the number takes them over (freed on failure)
+ * @len: number of words, at least 1
+ *
+ * Return: the number, NULL on failure
+ */
+infiX_bits *from_twos(uint32_t *words, size_t len)
+{
+	infiX_bits *n = xcalloc(1, sizeof(*n));
+	size_t i = 0;
+
+	if (!n)
+		return (free_n_null(words));
+
+	n->words = words;
+	n->len = len;
+	n->is_negative = (words[len - 1] >> 31);
+	if (n->is_negative)
+	{
+		/*-m = ~m + 1*/
+		for (i = 0; i < len; i++)
+			words[i] = ~words[i];
+
+		add_one(words, len);
+	}
+
+	trim_bits(n);
+	return (n);
+}
+
+/**
+ * bitwise - and, or or xor two binary numbers.
+ * @n1: the first number
+ * @n2: the second number
+ * @op: '&', '|' or '^'
+ *
+ * Description: both numbers are written in two's complement one word longer
+ * than the longest, so each result word is one machine operation.
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_bits *bitwise(const infiX_bits *n1, const infiX_bits *n2, char op)
+{
+	size_t len = (n1->len > n2->len ? n1->len : n2->len) + 1, i = 0;
+	uint32_t *a = xmalloc(sizeof(*a) * len), *b = xmalloc(sizeof(*b) * len);
+
+	if (!a || !b)
+	{
+		a = free_n_null(a);
+		return (free_n_null(b));
+	}
+
+	to_twos(a, len, n1);
+	to_twos(b, len, n2);
+	for (i = 0; i < len; i++)
+	{
+		if (op == '&')
+			a[i] &= b[i];
+		else if (op == '|')
+			a[i] |= b[i];
+		else
+			a[i] ^= b[i];
+	}
+
+	b = free_n_null(b);
+	return (from_twos(a, len));
+}
+
+/**
+ * bits_from_u4b - convert a u4b_array to its binary form.
+ * @n: the number
+ *
+ * Description: the limbs are converted to base 2^16 digits, see
+ * intarr_to_radix_digits(), and two digits make a word.
+ *
+ * Return: the binary number (free with free_infiX_bits()), NULL on failure
+ */
+infiX_bits *bits_from_u4b(const u4b_array *n)
+{
+	uint16_t *digits = NULL;
+	infiX_bits *bits = NULL;
+	size_t len = 0, i = 0;
+
+	if (!n)
+		return (NULL);
+
+	digits = intarr_to_radix_digits(n, RADIX_WORD_BASE, &len);
+	if (!digits)
+		return (NULL);
+
+	bits = alloc_bits((len + 1) / 2);
+	if (bits)
+	{
+		for (i = 0; i < len; i++)
+			bits->words[i / 2] |= (uint32_t)digits[len - 1 - i] << (16 * (i % 2));
+
+		bits->is_negative = n->is_negative;
+		trim_bits(bits);
+	}
+
+	digits = free_n_null(digits);
+	return (bits);
+}
+
+/**
+ * bits_to_u4b - convert a binary number to a u4b_array.
+ * @n: the binary number
+ *
+ * Return: pointer to a normalized u4b_array, NULL on failure
+ */
+u4b_array *bits_to_u4b(const infiX_bits *n)
+{
+	uint16_t *digits = NULL;
+	u4b_array *arr = NULL;
+	size_t len = 0, i = 0;
+
+	if (!n)
+		return (NULL);
+
+	len = 2 * n->len;
+	digits = xmalloc(sizeof(*digits) * (len + 1));
+	if (!digits)
+		return (NULL);
+
+	for (i = 0; i < len; i++)
+		digits[len - 1 - i] = (n->words[i / 2] >> (16 * (i % 2))) & UINT16_MAX;
+
+	arr = radix_digits_to_intarray(digits, len, RADIX_WORD_BASE);
+	digits = free_n_null(digits);
+	if (arr)
+	{
+		arr->is_negative = n->is_negative;
+		trim_u4b_array(arr);
+	}
+
+	return (arr);
+}
+
+/**
+ * free_infiX_bits - free a binary number.
+ * @n: the number, may be NULL
+ *
+ * Return: NULL always.
+ */
+void *free_infiX_bits(infiX_bits *n)
+{
+	if (!n)
+		return (NULL);
+
+	n->words = free_n_null(n->words);
+	return (free_n_null(n));
+}
+
+/**
+ * bits_and - bitwise and of two binary numbers.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_bits *bits_and(const infiX_bits *n1, const infiX_bits *n2)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (bitwise(n1, n2, '&'));
+}
+
+/**
+ * bits_or - bitwise or of two binary numbers.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_bits *bits_or(const infiX_bits *n1, const infiX_bits *n2)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (bitwise(n1, n2, '|'));
+}
+
+/**
+ * bits_xor - bitwise exclusive or of two binary numbers.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_bits *bits_xor(const infiX_bits *n1, const infiX_bits *n2)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (bitwise(n1, n2, '^'));
+}
+
+/**
+ * bits_not - bitwise complement of a binary number.
+ * @n: the number
+ *
+ * Description: ~n is -n - 1, so the magnitude only gains or loses 1.
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_bits *bits_not(const infiX_bits *n)
+{
+	infiX_bits *result = NULL;
+	size_t i = 0;
+
+	if (!n)
+		return (NULL);
+
+	result = alloc_bits(n->len + 1);
+	if (!result)
+		return (NULL);
+
+	if (n->len)
+		memcpy(result->words, n->words, sizeof(*n->words) * n->len);
+
+	result->is_negative = !n->is_negative;
+	if (n->is_negative)
+	{
+		/*~-m = m - 1, m is not zero.*/
+		for (i = 0; !result->words[i]; i++)
+			result->words[i] = UINT32_MAX;
+
+		result->words[i]--;
+	}
+	else
+		add_one(result->words, result->len);
+
+	trim_bits(result);
+	return (result);
+}
+
+/**
+ * bits_shift_left - multiply a binary number by a power of two.
+ * @n: the number
+ * @shift: the power of two
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_bits *bits_shift_left(const infiX_bits *n, size_t shift)
+{
+	size_t words = shift / 32, bits = shift % 32, i = 0;
+	infiX_bits *result = NULL;
+
+	if (!n)
+		return (NULL);
+
+	if (!n->len)
+		return (alloc_bits(0));
+
+	if (words > SIZE_MAX / sizeof(*n->words) - n->len - 1)
+		return (NULL);
+
+	result = alloc_bits(n->len + words + 1);
+	if (!result)
+		return (NULL);
+
+	for (i = 0; i < n->len; i++)
+	{
+		result->words[i + words] |= n->words[i] << bits;
+		if (bits)
+			result->words[i + words + 1] = n->words[i] >> (32 - bits);
+	}
+
+	result->is_negative = n->is_negative;
+	trim_bits(result);
+	return (result);
+}
+
+/**
+ * bits_shift_right - divide a binary number by a power of two.
+ * @n: the number
+ * @shift: the power of two
+ *
+ * Description: the quotient is floored like infiX_division()'s, as shifting
+ * two's complement right does, -5 >> 1 is -3.
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_bits *bits_shift_right(const infiX_bits *n, size_t shift)
+{
+	size_t words = shift / 32, bits = shift % 32, i = 0;
+	infiX_bits *result = NULL;
+	char dropped = 0;
+
+	if (!n)
+		return (NULL);
+
+	for (i = 0; i < words && i < n->len; i++)
+		dropped |= (n->words[i] != 0);
+
+	if (words < n->len && bits)
+		dropped |= ((n->words[words] & ((UINT32_C(1) << bits) - 1)) != 0);
+
+	/*One more word for the 1 added to negative numbers.*/
+	result = alloc_bits(words < n->len ? n->len - words + 1 : 1);
+	if (!result)
+		return (NULL);
+
+	for (i = 0; i + words < n->len; i++)
+	{
+		result->words[i] = n->words[i + words] >> bits;
+		if (bits && i + words + 1 < n->len)
+			result->words[i] |= n->words[i + words + 1] << (32 - bits);
+	}
+
+	/*-5 >> 1 = -((5 >> 1) + 1)*/
+	result->is_negative = n->is_negative;
+	if (n->is_negative && dropped)
+		add_one(result->words, result->len);
+
+	trim_bits(result);
+	return (result);
+}
+
+/**
+ * shift_count - read the number of bits to shift by.
+ * @n: the number
+ * @shift: where to store it
+ *
+ * Description: counts past SIZE_MAX are stored as SIZE_MAX, too many bits
+ * to shift left by anyway.
+ *
+ * Return: 0 on success, -1 if n is negative
+ */
+int shift_count(const u4b_array *n, size_t *shift)
+{
+	u4b_array view = slice_u4b_array(n, 0, n->len);
+	uint64_t count = 0;
+
+	trim_u4b_array(&view);
+	if (view.is_negative)
+	{
+		fprintf(stderr, "Negative shift count.\n");
+		return (-1);
+	}
+
+	if (view.len > 2)
+		count = UINT64_MAX;
+	else if (view.len)
+		count = view.array[0] + (view.len > 1 ? (uint64_t)view.array[1] * MAX_VAL_u4b : 0);
+
+	*shift = count > SIZE_MAX ? SIZE_MAX : count;
+	return (0);
+}
+
+/**
+ * bits_op - do a bitwise operation on two u4b_arrays.
+ * @n1: the first number
+ * @n2: the second number, or the number of bits to shift n1 by
+ * @op: '&', '|', '^', '~' (n2 is ignored), '<' or '>'
+ *
+ * Description: the numbers are converted to their binary forms and back.
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+u4b_array *bits_op(const u4b_array *n1, const u4b_array *n2, char op)
+{
+	infiX_bits *b1 = NULL, *b2 = NULL, *result = NULL;
+	u4b_array *arr = NULL;
+	size_t shift = 0;
+
+	if (!n1 || (!n2 && op != '~'))
+		return (NULL);
+
+	if ((op == '<' || op == '>') && shift_count(n2, &shift))
+		return (NULL);
+
+	b1 = bits_from_u4b(n1);
+	if (b1 && (op == '&' || op == '|' || op == '^'))
+	{
+		b2 = bits_from_u4b(n2);
+		if (b2)
+			result = bitwise(b1, b2, op);
+	}
+	else if (b1 && op == '~')
+		result = bits_not(b1);
+	else if (b1 && op == '<')
+		result = bits_shift_left(b1, shift);
+	else if (b1)
+		result = bits_shift_right(b1, shift);
+
+	arr = bits_to_u4b(result);
+	b1 = free_infiX_bits(b1);
+	b2 = free_infiX_bits(b2);
+	result = free_infiX_bits(result);
+	return (arr);
+}
+
+/**
+ * infiX_and - bitwise and of two numbers.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Description: see struct infiX_bits for negative numbers.
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+u4b_array *infiX_and(const u4b_array *n1, const u4b_array *n2)
+{
+	return (bits_op(n1, n2, '&'));
+}
+
+/**
+ * infiX_or - bitwise or of two numbers.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Description: see struct infiX_bits for negative numbers.
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+u4b_array *infiX_or(const u4b_array *n1, const u4b_array *n2)
+{
+	return (bits_op(n1, n2, '|'));
+}
+
+/**
+ * infiX_xor - bitwise exclusive or of two numbers.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Description: see struct infiX_bits for negative numbers.
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+u4b_array *infiX_xor(const u4b_array *n1, const u4b_array *n2)
+{
+	return (bits_op(n1, n2, '^'));
+}
+
+/**
+ * infiX_not - bitwise complement of a number.
+ * @n1: the number
+ * @n2: ignored, so it fits math_function
+ *
+ * Return: pointer to the result (-n1 - 1), NULL on failure
+ */
+u4b_array *infiX_not(const u4b_array *n1, const u4b_array *n2)
+{
+	return (bits_op(n1, n2, '~'));
+}
+
+/**
+ * infiX_lshift - shift a number left by a number of bits.
+ * @n1: the number
+ * @n2: the number of bits, not negative
+ *
+ * Return: pointer to the result (n1 * 2^n2), NULL on failure
+ */
+u4b_array *infiX_lshift(const u4b_array *n1, const u4b_array *n2)
+{
+	return (bits_op(n1, n2, '<'));
+}
+
+/**
+ * infiX_rshift - shift a number right by a number of bits.
+ * @n1: the number
+ * @n2: the number of bits, not negative
+ *
+ * Return: pointer to the result (n1 / 2^n2 floored), NULL on failure
+ */
+u4b_array *infiX_rshift(const u4b_array *n1, const u4b_array *n2)
+{
+	return (bits_op(n1, n2, '>'));
+}
@@ -0,0 +1,334 @@
+#include "infiX.h"
+
+static infiX_decimal *wrap_mantissa(u4b_array *mantissa, size_t scale, char is_negative);
+static u4b_array *rescale(const u4b_array *n, size_t from, size_t to) ATTR_NONNULL;
+static infiX_decimal *add_aligned(math_function *f, const infiX_decimal *n1,
+								  const infiX_decimal *n2, size_t places) ATTR_NONNULL;
+
+/**
+ * wrap_mantissa - make a decimal out of a mantissa.
+ * @mantissa: the mantissa, the decimal takes it over (freed on failure), may
+ * be NULL
+ * @scale: number of decimal places
+ * @is_negative: sign of the decimal, ignored for zero
+ *
+ * Return: the decimal, NULL on failure
+ */
+infiX_decimal *wrap_mantissa(u4b_array *mantissa, size_t scale, char is_negative)
+{
+	infiX_decimal *n = NULL;
+
+	if (!mantissa)
+		return (NULL);
+
+	n = xcalloc(1, sizeof(*n));
+	if (!n)
+	{
+		mantissa = free_u4b_array(mantissa);
+		return (NULL);
+	}
+
+	mantissa->is_negative = is_negative;
+	trim_u4b_array(mantissa);
+	ASSERT_NORMALIZED(mantissa);
+	n->mantissa = mantissa;
+	n->scale = scale;
+	return (n);
+}
+
+/**
+ * rescale - change the number of decimal places of a mantissa.
+ * @n: the mantissa
+ * @from: its number of decimal places
+ * @to: the number of decimal places wanted
+ *
+ * Description: dropped decimal places are truncated towards zero.
+ *
+ * Return: the new mantissa, NULL on failure
+ */
+u4b_array *rescale(const u4b_array *n, size_t from, size_t to)
+{
+	u4b_array view = slice_u4b_array(n, 0, n->len), *result = NULL;
+
+	if (to >= from)
+		return (infiX_shift_left(n, to - from));
+
+	/*infiX_shift_right() floors, the magnitude truncates.*/
+	view.is_negative = 0;
+	result = infiX_shift_right(&view, from - to);
+	if (result)
+	{
+		result->is_negative = n->is_negative;
+		trim_u4b_array(result);
+	}
+
+	return (result);
+}
+
+/**
+ * add_aligned - add or subtract two decimals.
+ * @f: infiX_addition or infiX_subtraction
+ * @n1: the first decimal
+ * @n2: the second decimal
+ * @places: number of decimal places of the result
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_decimal *add_aligned(math_function *f, const infiX_decimal *n1,
+						   const infiX_decimal *n2, size_t places)
+{
+	size_t scale = n1->scale > n2->scale ? n1->scale : n2->scale;
+	u4b_array *a1 = NULL, *a2 = NULL, *sum = NULL, *result = NULL;
+
+	a1 = infiX_shift_left(n1->mantissa, scale - n1->scale);
+	a2 = infiX_shift_left(n2->mantissa, scale - n2->scale);
+	if (a1 && a2)
+		sum = f(a1, a2);
+
+	if (sum)
+		result = rescale(sum, scale, places);
+
+	a1 = free_u4b_array(a1);
+	a2 = free_u4b_array(a2);
+	sum = free_u4b_array(sum);
+	return (wrap_mantissa(result, places, result ? result->is_negative : 0));
+}
+
+/**
+ * decimal_new - make a decimal from a mantissa and a scale.
+ * @mantissa: the number without its decimal point, it is copied
+ * @scale: number of decimal places, 12345 with a scale of 2 is 123.45
+ *
+ * Return: the decimal (free with free_infiX_decimal()), NULL on failure
+ */
+infiX_decimal *decimal_new(const u4b_array *mantissa, size_t scale)
+{
+	u4b_array *copy = NULL;
+
+	if (!mantissa)
+		return (NULL);
+
+	copy = dup_u4b_array(mantissa);
+	return (wrap_mantissa(copy, scale, mantissa->is_negative));
+}
+
+/**
+ * decimal_from_str - convert a string with a decimal point to a decimal.
+ * @num_str: a string of numbers as for str_to_intarray(), with at most one
+ * decimal point before any exponent
+ *
+ * Description: the scale is the number of digits after the point, so
+ * "-1.50" has a mantissa of -150 and a scale of 2. An exponent scales the
+ * mantissa instead, "1.5e3" has a mantissa of 15000 and a scale of 1.
+ *
+ * Return: the decimal (free with free_infiX_decimal()), NULL on failure
+ */
+infiX_decimal *decimal_from_str(const char *num_str)
+{
+	char *digits = NULL, *point = NULL;
+	size_t i = 0, scale = 0;
+	u4b_array *mantissa = NULL;
+
+	if (!num_str)
+		return (NULL);
+
+	digits = xmalloc(strlen(num_str) + 1);
+	if (!digits)
+		return (NULL);
+
+	strcpy(digits, num_str);
+	point = strchr(digits, '.');
+	if (point)
+	{
+		/*The digits of an exponent are not decimal places.*/
+		for (i = 1; point[i] && point[i] != 'e' && point[i] != 'E'; i++)
+			scale += (point[i] >= '0' && point[i] <= '9');
+
+		memmove(point, &point[1], strlen(&point[1]) + 1);
+	}
+
+	mantissa = str_to_intarray(digits);
+	digits = free_n_null(digits);
+	return (wrap_mantissa(mantissa, scale, mantissa ? mantissa->is_negative : 0));
+}
+
+/**
+ * decimal_to_str - convert a decimal to a string.
+ * @n: the decimal
+ *
+ * Description: all scale decimal places are written, 150 with a scale of 4
+ * is "0.0150".
+ *
+ * Return: a pointer to the string, NULL on failure
+ */
+char *decimal_to_str(const infiX_decimal *n)
+{
+	u4b_array view = {0};
+	char *digits = NULL, *num_str = NULL;
+	size_t len = 0, pad = 0, w = 0;
+
+	if (!n)
+		return (NULL);
+
+	if (!n->scale)
+		return (intarr_to_str(n->mantissa));
+
+	view = slice_u4b_array(n->mantissa, 0, n->mantissa->len);
+	view.is_negative = 0;
+	digits = intarr_to_str(&view);
+	if (!digits)
+		return (NULL);
+
+	len = strlen(digits);
+	/*At least one digit before the point.*/
+	pad = len <= n->scale ? n->scale + 1 - len : 0;
+	num_str = xcalloc(1 + pad + len + 1 + 1, sizeof(*num_str));
+	if (num_str)
+	{
+		if (n->mantissa->is_negative)
+			num_str[w++] = '-';
+
+		memset(&num_str[w], '0', pad);
+		w += pad;
+		memcpy(&num_str[w], digits, len);
+		w += len;
+		/*Make room for the point before the last scale digits.*/
+		memmove(&num_str[w - n->scale + 1], &num_str[w - n->scale], n->scale);
+		num_str[w - n->scale] = '.';
+	}
+
+	digits = free_n_null(digits);
+	return (num_str);
+}
+
+/**
+ * free_infiX_decimal - free a decimal.
+ * @n: the decimal, may be NULL
+ *
+ * Return: NULL always.
+ */
+void *free_infiX_decimal(infiX_decimal *n)
+{
+	if (!n)
+		return (NULL);
+
+	n->mantissa = free_u4b_array(n->mantissa);
+	return (free_n_null(n));
+}
+
+/**
+ * decimal_addition - add two decimals.
+ * @n1: the first decimal
+ * @n2: the second decimal
+ * @places: number of decimal places of the result, the rest are truncated
+ * towards zero
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_decimal *decimal_addition(const infiX_decimal *n1, const infiX_decimal *n2,
+								size_t places)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (add_aligned(infiX_addition, n1, n2, places));
+}
+
+/**
+ * decimal_subtraction - subtract two decimals.
+ * @n1: the first decimal
+ * @n2: the decimal to subtract
+ * @places: number of decimal places of the result, the rest are truncated
+ * towards zero
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_decimal *decimal_subtraction(const infiX_decimal *n1, const infiX_decimal *n2,
+								   size_t places)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (add_aligned(infiX_subtraction, n1, n2, places));
+}
+
+/**
+ * decimal_multiplication - multiply two decimals.
+ * @n1: the first decimal
+ * @n2: the second decimal
+ * @places: number of decimal places of the result, the rest are truncated
+ * towards zero
+ *
+ * Description: when places is less than the scales of n1 and n2 together,
+ * the limbs below it are not computed, see infiX_multiplication_high(). The
+ * result is the same as truncating the full product.
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_decimal *decimal_multiplication(const infiX_decimal *n1, const infiX_decimal *n2,
+									  size_t places)
+{
+	u4b_array a = {0}, b = {0}, *product = NULL;
+	size_t scale = 0, drop = 0;
+
+	if (!n1 || !n2)
+		return (NULL);
+
+	a = slice_u4b_array(n1->mantissa, 0, n1->mantissa->len);
+	b = slice_u4b_array(n2->mantissa, 0, n2->mantissa->len);
+	a.is_negative = 0;
+	b.is_negative = 0;
+	scale = n1->scale + n2->scale;
+	if (scale <= places)
+	{
+		product = infiX_multiplication(&a, &b);
+		if (product && !infiX_shift_left_into(product, product, places - scale))
+			product = free_u4b_array(product);
+	}
+	else
+	{
+		drop = scale - places;
+		product = infiX_multiplication_high(&a, &b, drop / MAX_DIGITS_u4b);
+		if (product &&
+			!infiX_shift_right_into(product, product, drop % MAX_DIGITS_u4b))
+			product = free_u4b_array(product);
+	}
+
+	return (wrap_mantissa(product, places,
+						  n1->mantissa->is_negative != n2->mantissa->is_negative));
+}
+
+/**
+ * decimal_division - divide two decimals.
+ * @n1: the numerator
+ * @n2: the denominator
+ * @places: number of decimal places of the result, the rest are truncated
+ * towards zero
+ *
+ * Return: the result, NULL on failure or division by zero
+ */
+infiX_decimal *decimal_division(const infiX_decimal *n1, const infiX_decimal *n2,
+								size_t places)
+{
+	u4b_array a = {0}, b = {0}, *numerator = NULL, *quotient = NULL;
+
+	if (!n1 || !n2)
+		return (NULL);
+
+	a = slice_u4b_array(n1->mantissa, 0, n1->mantissa->len);
+	b = slice_u4b_array(n2->mantissa, 0, n2->mantissa->len);
+	a.is_negative = 0;
+	b.is_negative = 0;
+	/*a / 10^s1 / (b / 10^s2) * 10^places = a * 10^(places + s2 - s1) / b*/
+	if (places + n2->scale >= n1->scale)
+		numerator = infiX_shift_left(&a, places + n2->scale - n1->scale);
+	else
+		numerator = infiX_shift_right(&a, n1->scale - places - n2->scale);
+
+	if (numerator)
+		quotient = infiX_division(numerator, &b);
+
+	numerator = free_u4b_array(numerator);
+	return (wrap_mantissa(quotient, places,
+						  n1->mantissa->is_negative != n2->mantissa->is_negative));
+}
@@ -0,0 +1,302 @@
+#include "infiX.h"
+
+static size_t limb_digits(uint32_t limb);
+static size_t write_limbs(char *dst, const uint32_t *limbs, size_t n,
+						  int pad_top) ATTR_NONNULL;
+static size_t top_digits(const u4b_array *num, size_t k, char *dst) ATTR_NONNULL;
+
+/**
+ * limb_digits - count the decimal digits of a limb.
+ * @limb: the limb
+ *
+ * Return: number of digits, 1 for 0
+ */
+size_t limb_digits(uint32_t limb)
+{
+	size_t digits = 1;
+
+	for (; limb >= 10; limb /= 10)
+		digits++;
+
+	return (digits);
+}
+
+/**
+ * write_limbs - write limbs as decimal digits, most significant first.
+ * @dst: where to write, room for n * MAX_DIGITS_u4b digits and a null byte
+ * @limbs: the limbs, little endian
+ * @n: number of limbs to write, at least 1
+ * @pad_top: 1 if the top limb's leading zeros are written too
+ *
+ * Return: number of digits written
+ */
+size_t write_limbs(char *dst, const uint32_t *limbs, size_t n, int pad_top)
+{
+	size_t h = n - 1;
+	int written = 0;
+
+	if (pad_top)
+		written = sprintf(dst, "%09" PRIu32, limbs[h]);
+	else
+		written = sprintf(dst, "%" PRIu32, limbs[h]);
+
+	for (; h > 0; h--)
+		written += sprintf(&dst[written], "%09" PRIu32, limbs[h - 1]);
+
+	return ((size_t)written);
+}
+
+/**
+ * top_digits - write the leading digits of a number's magnitude.
+ * @num: the number, trimmed
+ * @k: most digits to write
+ * @dst: where to write, room for k + 2 * MAX_DIGITS_u4b digits and a null
+ * byte
+ *
+ * Description: only the top k / MAX_DIGITS_u4b + 2 limbs are read.
+ *
+ * Return: number of digits written, the lesser of k and the number's digits
+ */
+size_t top_digits(const u4b_array *num, size_t k, char *dst)
+{
+	size_t limbs = k / MAX_DIGITS_u4b + 2, written = 0;
+
+	if (!num->len || !k)
+	{
+		dst[0] = k ? '0' : '\0';
+		dst[1] = '\0';
+		return (k ? 1 : 0);
+	}
+
+	/*The top limb has at least one digit, the rest MAX_DIGITS_u4b each.*/
+	if (limbs > num->len)
+		limbs = num->len;
+
+	written = write_limbs(dst, &num->array[num->len - limbs], limbs, 0);
+	if (written > k)
+		written = k;
+
+	dst[written] = '\0';
+	return (written);
+}
+
+/**
+ * intarr_digit_count - count the decimal digits of a number.
+ * @arr: the number
+ *
+ * Description: only the top limb is looked at, the digits are not written.
+ * The sign is not counted.
+ *
+ * Return: number of digits, 1 for 0, 0 if arr is NULL
+ */
+size_t intarr_digit_count(const u4b_array *arr)
+{
+	u4b_array num = {0};
+
+	if (!arr)
+		return (0);
+
+	num = slice_u4b_array(arr, 0, arr->len);
+	trim_u4b_array(&num);
+	if (!num.len)
+		return (1);
+
+	return ((num.len - 1) * MAX_DIGITS_u4b + limb_digits(num.array[num.len - 1]));
+}
+
+/**
+ * intarr_first_digits - write the leading digits of a number.
+ * @arr: the number
+ * @k: number of digits wanted
+ *
+ * Description: the digits are truncated, not rounded, and preceded by a '-'
+ * for negative numbers. Only the top limbs holding them are written, see
+ * intarr_to_str() for the whole number.
+ *
+ * Return: a string of the first k digits (all of them if arr has fewer),
+ * NULL on failure
+ */
+char *intarr_first_digits(const u4b_array *arr, size_t k)
+{
+	u4b_array num = {0};
+	size_t count = 0;
+	char *num_str = NULL;
+
+	if (!arr)
+		return (NULL);
+
+	num = slice_u4b_array(arr, 0, arr->len);
+	trim_u4b_array(&num);
+	count = intarr_digit_count(&num);
+	if (k > count)
+		k = count;
+
+	num_str = xcalloc(1 + k + 2 * MAX_DIGITS_u4b + 1, sizeof(*num_str));
+	if (!num_str)
+		return (NULL);
+
+	if (num.is_negative && k)
+		num_str[0] = '-';
+
+	top_digits(&num, k, &num_str[num_str[0] ? 1 : 0]);
+	return (num_str);
+}
+
+/**
+ * intarr_last_digits - write the trailing digits of a number.
+ * @arr: the number
+ * @k: number of digits wanted
+ *
+ * Description: the digits are written straight from the low limbs, with
+ * their zeros, so the last 3 digits of 1000000007 are "007". They are
+ * preceded by a '-' for negative numbers, like intarr_first_digits().
+ *
+ * Return: a string of the last k digits (all of them if arr has fewer), NULL
+ * on failure
+ */
+char *intarr_last_digits(const u4b_array *arr, size_t k)
+{
+	u4b_array num = {0};
+	size_t count = 0, limbs = 0, written = 0, w = 0;
+	char *num_str = NULL;
+
+	if (!arr)
+		return (NULL);
+
+	num = slice_u4b_array(arr, 0, arr->len);
+	trim_u4b_array(&num);
+	count = intarr_digit_count(&num);
+	if (k > count)
+		k = count;
+
+	limbs = k / MAX_DIGITS_u4b + (k % MAX_DIGITS_u4b ? 1 : 0);
+	num_str = xcalloc(1 + limbs * MAX_DIGITS_u4b + 2, sizeof(*num_str));
+	if (!num_str || !k)
+		return (num_str);
+
+	if (!num.len)
+	{
+		num_str[0] = '0';
+		return (num_str);
+	}
+
+	if (num.is_negative)
+		num_str[w++] = '-';
+
+	written = write_limbs(&num_str[w], num.array, limbs, limbs < num.len);
+	memmove(&num_str[w], &num_str[w + written - k], k + 1);
+	return (num_str);
+}
+
+/**
+ * intarr_to_sci_str - write a number in scientific notation.
+ * @arr: the number
+ * @precision: number of digits after the decimal point
+ *
+ * Description: the number is written as [-]d.ddde+N, e.g. 123456 with a
+ * precision of 2 is "1.23e+5". The digits are rounded half up from the
+ * digit after the last one kept. Only the top limbs are written, so this is
+ * cheap for any size of number.
+ *
+ * Return: a pointer to the string, NULL on failure
+ */
+char *intarr_to_sci_str(const u4b_array *arr, size_t precision)
+{
+	u4b_array num = {0};
+	size_t exponent = 0, n = 0, i = 0, w = 0;
+	char *digits = NULL, *sci_str = NULL;
+
+	if (!arr || precision > SIZE_MAX / 2)
+		return (NULL);
+
+	num = slice_u4b_array(arr, 0, arr->len);
+	trim_u4b_array(&num);
+	exponent = intarr_digit_count(&num) - 1;
+	digits = xcalloc(precision + 2 + 2 * MAX_DIGITS_u4b + 1, sizeof(*digits));
+	if (!digits)
+		return (NULL);
+
+	n = top_digits(&num, precision + 2, digits);
+	if (n == precision + 2)
+	{
+		n--;
+		if (digits[n] >= '5')
+		{
+			/*Carry into the kept digits, 9.99 becomes 10.00 (1.000e+1).*/
+			for (i = n; i > 0 && digits[i - 1] == '9'; i--)
+				digits[i - 1] = '0';
+
+			if (i > 0)
+				digits[i - 1]++;
+			else
+			{
+				digits[0] = '1';
+				exponent++;
+			}
+		}
+	}
+
+	/*Numbers with fewer digits than the precision are padded with zeros.*/
+	memset(&digits[n], '0', precision + 1 - n);
+	/*Sign, the digits, the point, "e+", the exponent and the null byte.*/
+	sci_str = xcalloc(1 + precision + 1 + 1 + 2 + 20 + 1, sizeof(*sci_str));
+	if (sci_str)
+	{
+		if (num.is_negative)
+			sci_str[w++] = '-';
+
+		sci_str[w++] = digits[0];
+		if (precision)
+		{
+			sci_str[w++] = '.';
+			memcpy(&sci_str[w], &digits[1], precision);
+			w += precision;
+		}
+
+		sprintf(&sci_str[w], "e+%zu", exponent);
+	}
+
+	digits = free_n_null(digits);
+	return (sci_str);
+}
+
+/**
+ * format_intarr - write a number in an output format.
+ * @arr: the number
+ * @format: the format, NULL for the whole number
+ *
+ * Description: only OUTPUT_FULL writes every digit of the number, see
+ * struct output_format.
+ *
+ * Return: a pointer to the string, NULL on failure
+ */
+char *format_intarr(const u4b_array *arr, const output_format *format)
+{
+	char *num_str = NULL;
+
+	if (!arr)
+		return (NULL);
+
+	if (!format || format->mode == OUTPUT_FULL)
+		return (intarr_to_str(arr));
+
+	if (format->mode == OUTPUT_DIGIT_COUNT)
+	{
+		num_str = xcalloc(21, sizeof(*num_str));
+		if (num_str)
+			sprintf(num_str, "%zu", intarr_digit_count(arr));
+
+		return (num_str);
+	}
+
+	if (format->mode == OUTPUT_FIRST_DIGITS)
+		return (intarr_first_digits(arr, format->digits));
+
+	if (format->mode == OUTPUT_LAST_DIGITS)
+		return (intarr_last_digits(arr, format->digits));
+
+	if (format->mode == OUTPUT_SCIENTIFIC)
+		return (intarr_to_sci_str(arr, format->digits));
+
+	return (NULL);
+}
@@ -1,370 +1,478 @@
 #include "infiX.h"
 
-u4b_array *remains = NULL;
-
-static u4b_array *divide_negatives(u4b_array *n1, u4b_array *n2)
-	ATTR_NONNULL;
-static int check_0_result(u4b_array *n1, u4b_array *n2) ATTR_NONNULL;
-static int check_division_by_0(u4b_array *n2) ATTR_NONNULL;
-static u4b_array *divide(u4b_array *n1, u4b_array *n2) ATTR_NONNULL;
-static ssize_t ATTR_NONNULL_IDX(1, 3)
-	get_current_quotient(uint32_t *working_slice, size_t len_slice, u4b_array *n2);
+static int check_division_by_0(const u4b_array *n2) ATTR_NONNULL;
+static int fix_signs(const u4b_array *n1, const u4b_array *n2,
+					 u4b_array *quotient, u4b_array *remainder)
+	ATTR_NONNULL_IDX(1, 2, 4);
+static int divide(const u4b_array *n1, const u4b_array *n2,
+				  const infiX_divisor *d, u4b_array *quotient,
+				  u4b_array *remainder) ATTR_NONNULL_IDX(1, 2, 5);
+#ifndef NDEBUG
+static int is_exact_quotient(const u4b_array *n1, const u4b_array *n2,
+							 const u4b_array *quotient) ATTR_NONNULL;
+#endif
+static int divmod(const u4b_array *n1, const u4b_array *n2,
+				  const infiX_divisor *d, u4b_array **quotient,
+				  u4b_array **remainder);
 
 /**
  * infiX_division - divides a numbers stored in an array
  * @n1: numerator
  * @n2: denominator
  *
- * @description
- *
  * Return: array with the result, NULL on failure
  */
-u4b_array *infiX_division(u4b_array *n1, u4b_array *n2)
+u4b_array *infiX_division(const u4b_array *n1, const u4b_array *n2)
 {
-	int is_zero = 0;
-	u4b_array *results = NULL;
+	u4b_array *quotient = NULL;
 
-	if (!n1 || !n2)
+	if (infiX_divmod(n1, n2, &quotient, NULL))
 		return (NULL);
 
-	remains = free_u4b_array(remains);
-	trim_u4b_array(n1);
-	trim_u4b_array(n2);
-
-	if (n1->is_negative || n2->is_negative)
-		return (divide_negatives(n1, n2));
+	return (quotient);
+}
 
-	if (check_division_by_0(n2))
-		return (NULL);
+/**
+ * infiX_modulus - calculates the remainder of a division
+ * @n1: numerator
+ * @n2: denominator
+ *
+ * Description: the quotient is never built, see infiX_divmod() for the sign
+ * of the remainder.
+ *
+ * Return: array with the result, NULL on failure
+ */
+u4b_array *infiX_modulus(const u4b_array *n1, const u4b_array *n2)
+{
+	u4b_array *remainder = NULL;
 
-	is_zero = check_0_result(n1, n2);
-	if (is_zero < 0)
+	if (infiX_divmod(n1, n2, NULL, &remainder))
 		return (NULL);
-	else if (is_zero > 0)
-		results = alloc_u4b_array(1);
-	else
-		results = divide(n1, n2);
 
-	remains = free_u4b_array(remains);
-	return (results);
+	return (remainder);
 }
 
 /**
- * infiX_modulus - does preliminary checks before getting remainder
- * @n1: numerator
+ * infiX_divexact - divides numbers when the remainder is known to be zero
+ * @n1: numerator, a multiple of n2
  * @n2: denominator
  *
+ * Description: uses limbs_divexact(), which needs no remainder and is faster
+ * than infiX_division(). If n1 is not a multiple of n2 the result is wrong,
+ * debug builds assert that it is not.
+ *
  * Return: array with the result, NULL on failure
  */
-u4b_array *infiX_modulus(u4b_array *n1, u4b_array *n2)
+u4b_array *infiX_divexact(const u4b_array *n1, const u4b_array *n2)
 {
-	int is_zero = 0;
-	u4b_array *results = NULL;
+	u4b_array *quotient = NULL;
+	u4b_array num = {0}, den = {0};
+	uint32_t *scratch = NULL;
 
 	if (!n1 || !n2)
 		return (NULL);
 
-	remains = free_u4b_array(remains);
-	trim_u4b_array(n1);
-	trim_u4b_array(n2);
+	num = slice_u4b_array(n1, 0, n1->len);
+	den = slice_u4b_array(n2, 0, n2->len);
+	trim_u4b_array(&num);
+	trim_u4b_array(&den);
+	if (check_division_by_0(&den))
+		return (NULL);
 
-	if (n1->is_negative || n2->is_negative)
+	if (num.len < den.len)
 	{
-		results = divide_negatives(n1, n2);
-		free_u4b_array(remains);
-		remains = infiX_subtraction(n1, results);
-		free_u4b_array(results);
-		return (remains);
+		/*Only 0 is a multiple of a longer number.*/
+		assert(!num.len || !num.array[0]);
+		return (alloc_u4b_array(1));
 	}
 
-	if (check_division_by_0(n2))
-		return (NULL);
-
-	is_zero = check_0_result(n1, n2);
-	if (is_zero < 0)
-		return (NULL);
-	else if (!is_zero)
-		free_u4b_array(divide(n1, n2));
+	quotient = alloc_u4b_array(num.len - den.len + 1);
+	scratch = xmalloc(sizeof(*scratch) * limbs_divexact_itch(num.len, den.len));
+	if (!quotient || !scratch)
+	{
+		free_n_null(scratch);
+		return (free_u4b_array(quotient));
+	}
 
-	return (remains);
+	limbs_divexact(quotient->array, num.array, num.len, den.array, den.len,
+				   scratch);
+	scratch = free_n_null(scratch);
+	quotient->is_negative = (num.is_negative != den.is_negative);
+	trim_u4b_array(quotient);
+	ASSERT_NORMALIZED(quotient);
+	assert(is_exact_quotient(&num, &den, quotient));
+	return (quotient);
 }
 
+#ifndef NDEBUG
 /**
- * divide_negatives - division of signed numbers (negative numbers).
- * @n1: numerator.
- * @n2: denominator.
+ * is_exact_quotient - check a result of infiX_divexact().
+ * @n1: numerator
+ * @n2: denominator
+ * @quotient: n1 / n2
  *
- * Return: pointer to the results, NULL on failure.
+ * Return: 1 if quotient * n2 is n1, else 0.
  */
-u4b_array *divide_negatives(u4b_array *n1, u4b_array *n2)
+int is_exact_quotient(const u4b_array *n1, const u4b_array *n2,
+					  const u4b_array *quotient)
 {
-	uint32_t a[] = {1};
-	u4b_array *tmp = NULL, *result = NULL;
-	u4b_array one = {.len = 1, .is_negative = 0, .array = a};
-
-	if (n1->is_negative && n2->is_negative)
-	{
-		/* -8 // -5 = 8//5*/
-		n1->is_negative = 0;
-		n2->is_negative = 0;
-		result = infiX_division(n1, n2);
-		n1->is_negative = 1;
-		n2->is_negative = 1;
-	}
-	else if (n1->is_negative)
-	{
-		/* -8 // 5 = -((8 // 5) + 1)*/
-		n1->is_negative = 0;
-		tmp = infiX_division(n1, n2);
-		result = infiX_addition(tmp, &one);
-		tmp = free_u4b_array(tmp);
-		n1->is_negative = 1;
-		if (result)
-			result->is_negative = 1;
-	}
-	else if (n2->is_negative)
-	{
-		/* 8 // -5 = -((8 // 5) + 1) */
-		n2->is_negative = 0;
-		tmp = infiX_division(n1, n2);
-		result = infiX_addition(tmp, &one);
-		tmp = free_u4b_array(tmp);
-		n2->is_negative = 1;
-		if (result)
-			result->is_negative = 1;
-	}
+	u4b_array *product = infiX_multiplication(quotient, n2);
+	int is_exact = (product && !cmp_u4barray(product, n1));
 
-	return (result);
+	free_u4b_array(product);
+	return (is_exact);
 }
+#endif /*NDEBUG*/
 
 /**
- * check_division_by_0 - checks if the denominator is zero.
+ * infiX_divmod - calculates the quotient and remainder of a division
+ * @n1: numerator
  * @n2: denominator
+ * @quotient: where to store the quotient, NULL if it is not needed
+ * @remainder: where to store the remainder, NULL if it is not needed
  *
- * Return: 1 if n2 is zero, else 0
+ * Description: the quotient is rounded towards negative infinity (floored).
+ * The remainder's magnitude is that of the floored division, it is negative
+ * if the signs of n1 and n2 differ.
+ * Both results come from one pass over n1 and no state is kept between
+ * calls. n1 and n2 are only read, so this can be called from multiple threads
+ * sharing the same operands.
+ *
+ * Return: 0 on success, -1 on failure (nothing is stored)
  */
-int check_division_by_0(u4b_array *n2)
+int infiX_divmod(const u4b_array *n1, const u4b_array *n2,
+				 u4b_array **quotient, u4b_array **remainder)
 {
-	if (!n2->len || (n2->len == 1 && !n2->array[0]))
-	{
-		fprintf(stderr, "Division by zero error.\n");
-		return (1);
-	}
-
-	return (0);
+	return (divmod(n1, n2, NULL, quotient, remainder));
 }
 
 /**
- * check_0_result - checks if numerator < denominator.
- * @n1: numerator
- * @n2: denominator
+ * infiX_divisor_new - prepare a denominator for repeated division.
+ * @den: the denominator
  *
- * Description: If numerator is less than denominator then;
- * quotient will be 0 and remainder will be equal to numerator.
+ * Description: the scaling and reciprocal that every infiX_divmod() call
+ * works out for its denominator are computed here once, the results of
+ * infiX_divmod_by() are the same as infiX_divmod()'s. den is copied, it can
+ * be freed afterwards. The divisor is only read when dividing, so it can be
+ * shared between threads.
  *
- * Return: 1 if result will be 0, 0 if not, -1 on error.
+ * Return: the divisor (free with free_infiX_divisor()), NULL if den is 0 or
+ * on failure
  */
-int check_0_result(u4b_array *n1, u4b_array *n2)
+infiX_divisor *infiX_divisor_new(const u4b_array *den)
 {
-	if (cmp_u4barray(n1, n2) >= 0)
-		return (0);
+	infiX_divisor *d = NULL;
+	u4b_array view = {0};
 
-	/*If n1 == 0; then remains == 0*/
-	if (n1->len < 2 && (!n1->array || !n1->array[0]))
-		remains = alloc_u4b_array(1);
-	else
-		remains = alloc_u4b_array(n1->len);
+	if (!den)
+		return (NULL);
 
-	if (!remains)
-		return (-1);
+	view = slice_u4b_array(den, 0, den->len);
+	trim_u4b_array(&view);
+	if (check_division_by_0(&view))
+		return (NULL);
+
+	d = xcalloc(1, sizeof(*d));
+	if (!d)
+		return (NULL);
+
+	d->den = dup_u4b_array(&view);
+	d->limbs = xmalloc(sizeof(*d->limbs) * view.len);
+	if (!d->den || !d->limbs)
+		return (free_infiX_divisor(d));
+
+	while (!view.array[d->zeros])
+		d->zeros++;
 
-	if (n1->len > 1 || (n1->len == 1 && n1->array[0]))
-		memmove(remains->array, n1->array, sizeof(*n1->array) * n1->len);
+	d->len = view.len - d->zeros;
+	d->scale = 1;
+	if (d->len > 1)
+		d->scale = MAX_VAL_u4b / ((uint64_t)view.array[view.len - 1] + 1);
 
-	return (1);
+	limbs_mul_1(d->limbs, &view.array[d->zeros], d->len, d->scale);
+	d->inverse = limbs_invert_limb(d->limbs[d->len - 1]);
+	return (d);
 }
 
 /**
- * divide - divides a numbers stored in an array
+ * free_infiX_divisor - free a divisor from infiX_divisor_new().
+ * @d: the divisor, may be NULL
+ *
+ * Return: NULL always.
+ */
+void *free_infiX_divisor(infiX_divisor *d)
+{
+	if (!d)
+		return (NULL);
+
+	d->den = free_u4b_array(d->den);
+	d->limbs = free_n_null(d->limbs);
+	return (free_n_null(d));
+}
+
+/**
+ * infiX_division_by - divide by a prepared denominator.
  * @n1: numerator
- * @n2: denominator
+ * @d: denominator from infiX_divisor_new()
  *
  * Return: array with the result, NULL on failure
  */
-u4b_array *divide(u4b_array *n1, u4b_array *n2)
+u4b_array *infiX_division_by(const u4b_array *n1, const infiX_divisor *d)
 {
-	uint32_t *working_slice = NULL;
-	size_t slice_offset = 1, q_i = 0, n1_i = 0, len_slice = 0;
-	ssize_t tmp = 0;
 	u4b_array *quotient = NULL;
 
-	/*Since division is reverse of multiplication then;*/
-	/*quotient digits = numerator digits - denominator digits + (0 or 1).*/
-	if (n1->array[n1->len - 1] < n2->array[n2->len - 1])
-		/*If msd of numerator < msd denominator.*/
-		quotient = alloc_u4b_array((n1->len - n2->len ? n1->len - n2->len : 1));
-	else
-		quotient = alloc_u4b_array(n1->len - n2->len + 1);
+	if (infiX_divmod_by(n1, d, &quotient, NULL))
+		return (NULL);
 
-	/*len_slice = len of n2, +1 for a dropdown*/
-	len_slice = n2->len + 1;
-	working_slice = xcalloc(len_slice, sizeof(*working_slice));
-	if (!working_slice || !quotient)
-	{
-		quotient = free_u4b_array(quotient);
-		working_slice = free_n_null(working_slice);
+	return (quotient);
+}
+
+/**
+ * infiX_modulus_by - the remainder of a division by a prepared denominator.
+ * @n1: numerator
+ * @d: denominator from infiX_divisor_new()
+ *
+ * Return: array with the result, NULL on failure
+ */
+u4b_array *infiX_modulus_by(const u4b_array *n1, const infiX_divisor *d)
+{
+	u4b_array *remainder = NULL;
+
+	if (infiX_divmod_by(n1, d, NULL, &remainder))
 		return (NULL);
-	}
 
-	n1_i = n1->len - n2->len;
-	memmove(&working_slice[slice_offset], &n1->array[n1_i], sizeof(*n1->array) * n2->len);
-	if (n1_i)
-		n1_i--;
+	return (remainder);
+}
+
+/**
+ * infiX_divmod_by - quotient and remainder of a division by a prepared
+ * denominator.
+ * @n1: numerator
+ * @d: denominator from infiX_divisor_new()
+ * @quotient: where to store the quotient, NULL if it is not needed
+ * @remainder: where to store the remainder, NULL if it is not needed
+ *
+ * Description: same results as infiX_divmod() with d's denominator.
+ *
+ * Return: 0 on success, -1 on failure (nothing is stored)
+ */
+int infiX_divmod_by(const u4b_array *n1, const infiX_divisor *d,
+					u4b_array **quotient, u4b_array **remainder)
+{
+	return (divmod(n1, d ? d->den : NULL, d, quotient, remainder));
+}
+
+/**
+ * divmod - calculates the quotient and remainder of a division
+ * @n1: numerator
+ * @n2: denominator
+ * @d: n2 prepared by infiX_divisor_new(), NULL if it has not been
+ * @quotient: where to store the quotient, NULL if it is not needed
+ * @remainder: where to store the remainder, NULL if it is not needed
+ *
+ * Return: 0 on success, -1 on failure (nothing is stored)
+ */
+int divmod(const u4b_array *n1, const u4b_array *n2, const infiX_divisor *d,
+		   u4b_array **quotient, u4b_array **remainder)
+{
+	u4b_array *q = NULL, *r = NULL;
+	u4b_array num = {0}, den = {0}, n1_abs = {0}, n2_abs = {0};
+
+	if (quotient)
+		*quotient = NULL;
+
+	if (remainder)
+		*remainder = NULL;
+
+	if (!n1 || !n2)
+		return (-1);
+
+	num = slice_u4b_array(n1, 0, n1->len);
+	den = slice_u4b_array(n2, 0, n2->len);
+	trim_u4b_array(&num);
+	trim_u4b_array(&den);
+	if (check_division_by_0(&den))
+		return (-1);
 
-	if (working_slice[len_slice - 1] < n2->array[n2->len - 1])
+	/*Divide the magnitudes, signs are fixed up afterwards.*/
+	n1_abs = num;
+	n2_abs = den;
+	n1_abs.is_negative = 0;
+	n2_abs.is_negative = 0;
+	if (quotient)
+		q = alloc_u4b_array(0);
+
+	r = alloc_u4b_array(0);
+	if (!r || (quotient && !q) || divide(&n1_abs, &n2_abs, d, q, r) ||
+		fix_signs(&num, &den, q, r))
 	{
-		/*If most significant digit (msd) of working_slice < msd of denominator then;*/
-		/*dropdown an extra digit from the numerator.*/
-		slice_offset = 0;
-		working_slice[0] = n1->array[n1_i];
-		if (n1_i)
-			n1_i--;
+		free_u4b_array(q);
+		free_u4b_array(r);
+		return (-1);
 	}
 
-	tmp = 0;
-	q_i = quotient->len;
-	while (q_i > 0)
+	ASSERT_NORMALIZED(r);
+	if (quotient)
 	{
-		q_i--;
-		tmp = get_current_quotient(working_slice + slice_offset,
-								   len_slice - slice_offset, n2);
-		if (tmp < 0)
-		{
-			quotient = free_u4b_array(quotient);
-			working_slice = free_n_null(working_slice);
-			return (NULL);
-		}
-
-		quotient->array[q_i] = tmp;
-		/*Copy remainder into working_slice starting from most significant digits.*/
-		memmove(&working_slice[len_slice - remains->len], remains->array,
-				sizeof(*remains->array) * remains->len);
-		slice_offset = 1;
-		tmp = n2->len - remains->len;
-		/*If remainder is shorter than denominator then; drop in more digits*/
-		if (q_i && (size_t)tmp > 0)
-		{
-			/*Checking for overflow.*/
-			if (n1_i + 1 > (size_t)tmp)
-				n1_i -= tmp;
-			else
-			{
-				slice_offset += (size_t)tmp - (n1_i + 1);
-				tmp = (n1_i + 1);
-				n1_i = 0;
-			}
-
-			memmove(&working_slice[slice_offset], &n1->array[n1_i],
-					sizeof(*n1->array) * tmp);
-			q_i -= tmp - 1;
-		}
-
-		if (q_i &&
-			cmp_rev_uint32array(&working_slice[slice_offset], n2->array, n2->len) < 0)
-		{
-			slice_offset = 0;
-			working_slice[0] = n1->array[n1_i];
-			if (n1_i)
-				n1_i--;
-		}
+		ASSERT_NORMALIZED(q);
+		*quotient = q;
 	}
 
-	remains = free_u4b_array(remains);
-	remains = alloc_u4b_array(len_slice - slice_offset);
-	if (remains)
-		memmove(remains->array, working_slice + slice_offset,
-				sizeof(*working_slice) * (len_slice - slice_offset));
+	if (remainder)
+		*remainder = r;
 	else
-		quotient = free_u4b_array(quotient);
+		free_u4b_array(r);
 
-	free_n_null(working_slice);
-	trim_u4b_array(quotient);
-	return (quotient);
+	return (0);
 }
 
 /**
- * get_current_quotient - calculate the current quotient.
- * @working_slice: the current digits being divided in an array.
- * @len_slice: length of working_slice.
- * @n2: the denominator.
+ * fix_signs - set the signs of a division's results from its operands.
+ * @n1: numerator, trimmed.
+ * @n2: denominator, trimmed.
+ * @quotient: |n1| / |n2|, NULL if not needed.
+ * @remainder: |n1| % |n2|.
  *
- * Return: an int representing current quotient, -1 on error.
+ * Return: 0 on success, -1 on failure.
  */
-ssize_t get_current_quotient(uint32_t *working_slice, size_t len_slice, u4b_array *n2)
+int fix_signs(const u4b_array *n1, const u4b_array *n2,
+			  u4b_array *quotient, u4b_array *remainder)
 {
-	uint32_t temp_array[1] = {0};
-	u4b_array q_estimate = {.len = 1, .is_negative = 0, .array = temp_array};
-	u4b_array slice_array = {.len = len_slice, .is_negative = 0, .array = NULL};
-	u4b_array *estimate_check = NULL;
-	ssize_t msd_slice = 0, is_larger = 0;
-
-	remains = free_u4b_array(remains);
-	slice_array.array = working_slice;
-	msd_slice = slice_array.array[len_slice - 1];
-	if (len_slice > n2->len)
-		msd_slice = (msd_slice * MAX_VAL_u4b) + slice_array.array[len_slice - 2];
-
-	/*quotient approximation ≈ most significant digit of current working_slice / */
-	/*msd of denominator.*/
-	q_estimate.array[0] = (int64_t)msd_slice / n2->array[n2->len - 1];
-	estimate_check = infiX_multiplication(n2, &q_estimate);
-	remains = infiX_subtraction(&slice_array, estimate_check);
-	if (!remains || !estimate_check)
+	uint32_t a[] = {1};
+	u4b_array one = {.len = 1, .is_negative = 0, .array = a};
+	u4b_array n2_abs = slice_u4b_array(n2, 0, n2->len);
+	char remainder_is_zero = (remainder->len < 2 && (!remainder->len || !remainder->array[0]));
+
+	n2_abs.is_negative = 0;
+	if (n1->is_negative == n2->is_negative)
+		return (0);
+
+	if (!remainder_is_zero)
 	{
-		remains = free_u4b_array(remains);
-		free_u4b_array(estimate_check);
-		return (-1);
+		/* -8 // 5 = -((8 // 5) + 1), -8 % 5 = -(5 - (8 % 5)) */
+		if (quotient && !infiX_addition_into(quotient, quotient, &one))
+			return (-1);
+
+		if (!infiX_subtraction_into(remainder, &n2_abs, remainder))
+			return (-1);
+
+		remainder->is_negative = 1;
 	}
 
-	/*0 <= (current working_slice - (q_estimate * denominator)) < denominator*/
-	is_larger = cmp_u4barray(remains, n2);
-	while (remains->is_negative || is_larger >= 0)
+	if (quotient)
 	{
-		if (remains->is_negative)
-		{
-			/*q_estimate was too big.*/
-			/*over_shoot = ceil(msd remains / msd denominator)*/
-
-			/*Test: for possible overflow.*/
-			/*Test: overshoot might be longer than denominator*/
-			q_estimate.array[0] -= remains->array[remains->len - 1] / n2->array[n2->len - 1];
-			if (remains->array[remains->len - 1] % n2->array[n2->len - 1])
-				q_estimate.array[0]--;
-		}
-		else
-		{
-			/*q_estimate was too small.*/
-			/*under_shoot = floor(msd remains / msd denominator)*/
-			q_estimate.array[0] += remains->array[remains->len - 1] / n2->array[n2->len - 1];
-		}
-
-		estimate_check = free_u4b_array(estimate_check);
-		remains = free_u4b_array(remains);
-
-		estimate_check = infiX_multiplication(n2, &q_estimate);
-		remains = infiX_subtraction(&slice_array, estimate_check);
-		if (!remains || !estimate_check)
-		{
-			remains = free_u4b_array(remains);
-			free_u4b_array(estimate_check);
+		quotient->is_negative = 1;
+		trim_u4b_array(quotient);
+	}
+
+	return (0);
+}
+
+/**
+ * check_division_by_0 - checks if the denominator is zero.
+ * @n2: denominator
+ *
+ * Return: 1 if n2 is zero, else 0
+ */
+int check_division_by_0(const u4b_array *n2)
+{
+	if (!n2->len || (n2->len == 1 && !n2->array[0]))
+	{
+		fprintf(stderr, "Division by zero error.\n");
+		return (1);
+	}
+
+	return (0);
+}
+
+/**
+ * divide - divides a numbers stored in an array
+ * @n1: numerator, trimmed and not negative
+ * @n2: denominator, trimmed and not negative or zero
+ * @d: n2 prepared by infiX_divisor_new(), NULL if it has not been
+ * @quotient: array to store the quotient in, NULL if it is not needed
+ * @remainder: array to store the remainder in
+ *
+ * Description: the limbs are divided by limbs_divrem(), whose scratch space
+ * is allocated once up front, or by limbs_divrem_preinv() in the remainder's
+ * buffer when n2 has been prepared.
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int divide(const u4b_array *n1, const u4b_array *n2, const infiX_divisor *d,
+		   u4b_array *quotient, u4b_array *remainder)
+{
+	uint32_t *scratch = NULL;
+	size_t itch = 0, zeros = 0;
+
+	if (resize_u4b_array(remainder, 0) || (quotient && resize_u4b_array(quotient, 0)))
+		return (-1);
+
+	remainder->is_negative = 0;
+	if (quotient)
+		quotient->is_negative = 0;
+
+	if (n1->len < n2->len)
+	{
+		/*The quotient is 0 and the remainder is all of n1.*/
+		if (resize_u4b_array(remainder, n1->len ? n1->len : 1) ||
+			(quotient && resize_u4b_array(quotient, 1)))
 			return (-1);
-		}
 
-		is_larger = cmp_u4barray(remains, n2);
+		if (n1->len)
+			memmove(remainder->array, n1->array, sizeof(*n1->array) * n1->len);
+
+		return (0);
 	}
 
-	free_u4b_array(estimate_check);
-	return (q_estimate.array[0]);
+	/*n1 / (d * B^zeros) = (n1 / B^zeros) / d, the remainder's low limbs are*/
+	/*n1's. A power of ten is left with one limb.*/
+	if (d)
+		zeros = d->zeros;
+	else
+		while (!n2->array[zeros])
+			zeros++;
+
+	/*Since division is reverse of multiplication then;*/
+	/*quotient digits = numerator digits - denominator digits + 1.*/
+	/*A prepared division scales n1 in the remainder's buffer, so it needs*/
+	/*no other scratch space.*/
+	if (resize_u4b_array(remainder, d && d->len > 1 ? n1->len + 1 : n2->len) ||
+		(quotient && resize_u4b_array(quotient, n1->len - n2->len + 1)))
+		return (-1);
+
+	if (!d)
+		itch = limbs_divrem_itch(n1->len - zeros, n2->len - zeros);
+
+	if (itch)
+	{
+		scratch = xmalloc(sizeof(*scratch) * itch);
+		if (!scratch)
+			return (-1);
+	}
+
+	if (d)
+		limbs_divrem_preinv(quotient ? quotient->array : NULL,
+							&remainder->array[zeros], &n1->array[zeros],
+							n1->len - zeros, d->limbs, d->len, d->scale,
+							d->inverse, &remainder->array[zeros]);
+	else
+		limbs_divrem(quotient ? quotient->array : NULL, &remainder->array[zeros],
+					 &n1->array[zeros], n1->len - zeros, &n2->array[zeros],
+					 n2->len - zeros, scratch);
+
+	scratch = free_n_null(scratch);
+	if (zeros)
+		memmove(remainder->array, n1->array, sizeof(*n1->array) * zeros);
+
+	if (resize_u4b_array(remainder, n2->len))
+		return (-1);
+
+	trim_u4b_array(remainder);
+	if (quotient)
+		trim_u4b_array(quotient);
+
+	return (0);
 }
 
 /**
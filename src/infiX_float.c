@@ -0,0 +1,411 @@
+#include "infiX.h"
+
+static infiX_float *round_float(u4b_array *mantissa, ssize_t exponent, size_t precision);
+static size_t pick_precision(const infiX_float *n1, const infiX_float *n2,
+							 size_t precision) ATTR_NONNULL;
+static int is_zero_float(const infiX_float *n) ATTR_NONNULL;
+static infiX_float *add_floats(math_function *f, const infiX_float *n1,
+							   const infiX_float *n2, size_t precision) ATTR_NONNULL;
+static u4b_array *isqrt(const u4b_array *n) ATTR_NONNULL;
+
+/**
+ * round_float - make a float out of a mantissa, truncated to a precision.
+ * @mantissa: the mantissa, the float takes it over (freed on failure), may be
+ * NULL
+ * @exponent: the value is mantissa * MAX_VAL_u4b^exponent
+ * @precision: most limbs to keep, 0 to keep them all
+ *
+ * Description: the limbs below the top precision ones are dropped, which
+ * truncates towards zero, and so are low zero limbs.
+ *
+ * Return: the float, NULL on failure
+ */
+infiX_float *round_float(u4b_array *mantissa, ssize_t exponent, size_t precision)
+{
+	infiX_float *n = NULL;
+	size_t drop = 0;
+
+	if (!mantissa)
+		return (NULL);
+
+	n = xcalloc(1, sizeof(*n));
+	if (!n)
+	{
+		mantissa = free_u4b_array(mantissa);
+		return (NULL);
+	}
+
+	trim_u4b_array(mantissa);
+	if (precision && mantissa->len > precision)
+		drop = mantissa->len - precision;
+
+	while (drop < mantissa->len && !mantissa->array[drop])
+		drop++;
+
+	if (drop == mantissa->len)
+	{
+		/*Zero.*/
+		resize_u4b_array(mantissa, 1);
+		mantissa->array[0] = 0;
+		mantissa->is_negative = 0;
+		exponent = 0;
+	}
+	else if (drop)
+	{
+		limbs_rshift(mantissa->array, mantissa->array, mantissa->len, drop);
+		resize_u4b_array(mantissa, mantissa->len - drop);
+		exponent += drop;
+	}
+
+	ASSERT_NORMALIZED(mantissa);
+	n->mantissa = mantissa;
+	n->exponent = exponent;
+	n->precision = precision ? precision : mantissa->len;
+	return (n);
+}
+
+/**
+ * pick_precision - the precision of an operation's result.
+ * @n1: the first operand
+ * @n2: the second operand
+ * @precision: the precision asked for, 0 for the larger of n1's and n2's
+ *
+ * Return: the precision in limbs.
+ */
+size_t pick_precision(const infiX_float *n1, const infiX_float *n2, size_t precision)
+{
+	if (precision)
+		return (precision);
+
+	return (n1->precision > n2->precision ? n1->precision : n2->precision);
+}
+
+/**
+ * is_zero_float - check if a float is zero.
+ * @n: the float
+ *
+ * Return: 1 if n is zero, else 0.
+ */
+int is_zero_float(const infiX_float *n)
+{
+	return (n->mantissa->len < 2 && !n->mantissa->array[0]);
+}
+
+/**
+ * add_floats - add or subtract two floats.
+ * @f: infiX_addition or infiX_subtraction
+ * @n1: the first float
+ * @n2: the second float
+ * @precision: most limbs of the result
+ *
+ * Description: the mantissas are aligned to the lower exponent and added
+ * exactly before truncating. When one operand is entirely below the
+ * result's precision it can only push the result off a multiple of its top
+ * limb's weight, so it is replaced by a single limb of 1 just below it. This
+ * gives the same truncated result and keeps the work bounded by the
+ * precision however far apart the exponents are.
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_float *add_floats(math_function *f, const infiX_float *n1,
+						const infiX_float *n2, size_t precision)
+{
+	uint32_t one[] = {1};
+	u4b_array a = slice_u4b_array(n1->mantissa, 0, n1->mantissa->len), *sum = NULL;
+	u4b_array b = slice_u4b_array(n2->mantissa, 0, n2->mantissa->len), *lo = NULL;
+	u4b_array *a_aligned = NULL, *b_aligned = NULL;
+	ssize_t e1 = n1->exponent, e2 = n2->exponent, t1 = e1 + a.len, t2 = e2 + b.len;
+	ssize_t *e_lo = NULL, e = 0;
+
+	if (is_zero_float(n1))
+		e1 = e2;
+
+	if (is_zero_float(n2))
+		e2 = e1;
+
+	/*Stand in for an operand far below the other one's precision.*/
+	lo = t1 < t2 ? &a : &b;
+	e_lo = t1 < t2 ? &e1 : &e2;
+	if (!is_zero_float(n1) && !is_zero_float(n2) &&
+		(t1 < t2 ? t1 + (ssize_t)precision + 1 <= t2 && t1 <= e2
+				 : t2 + (ssize_t)precision + 1 <= t1 && t2 <= e1))
+	{
+		*e_lo = (t1 < t2 ? t1 : t2) - 1;
+		lo->len = 1;
+		lo->array = one;
+	}
+
+	e = e1 < e2 ? e1 : e2;
+	a_aligned = infiX_shift_left(&a, (e1 - e) * MAX_DIGITS_u4b);
+	b_aligned = infiX_shift_left(&b, (e2 - e) * MAX_DIGITS_u4b);
+	if (a_aligned && b_aligned)
+		sum = f(a_aligned, b_aligned);
+
+	a_aligned = free_u4b_array(a_aligned);
+	b_aligned = free_u4b_array(b_aligned);
+	return (round_float(sum, e, precision));
+}
+
+/**
+ * isqrt - the integer square root of a number.
+ * @n: the number, normalized and not negative
+ *
+ * Description: Newton's iteration x = (x + n / x) / 2, started above the
+ * root from the square root of n's top limbs, stops as soon as x no longer
+ * decreases.
+ *
+ * Return: floor(sqrt(n)), NULL on failure
+ */
+u4b_array *isqrt(const u4b_array *n)
+{
+	u4b_array *x = NULL, *y = NULL, *q = NULL;
+	size_t half = (n->len - 1) / 2;
+	uint64_t top = n->array[n->len - 1], s = 0;
+
+	if (n->len < 2 && !n->array[0])
+		return (alloc_u4b_array(1));
+
+	/*n < (top + 1) * MAX_VAL_u4b^(2 * half) <= (s * MAX_VAL_u4b^half)^2*/
+	if (!(n->len & 1))
+		top = top * MAX_VAL_u4b + n->array[n->len - 2];
+
+	s = (uint64_t)sqrt((double)top) + 2;
+	x = alloc_u4b_array(half + 2);
+	if (!x)
+		return (NULL);
+
+	x->array[half] = s % MAX_VAL_u4b;
+	x->array[half + 1] = s / MAX_VAL_u4b;
+	trim_u4b_array(x);
+	while (x)
+	{
+		q = infiX_division(n, x);
+		y = q ? infiX_addition(x, q) : NULL;
+		q = free_u4b_array(q);
+		if (!y)
+			return (free_u4b_array(x));
+
+		limbs_divrem_1(y->array, y->array, y->len, 2);
+		trim_u4b_array(y);
+		if (cmp_u4barray(y, x) >= 0)
+			break;
+
+		x = free_u4b_array(x);
+		x = y;
+	}
+
+	y = free_u4b_array(y);
+	return (x);
+}
+
+/**
+ * float_from_decimal - convert a decimal to a float.
+ * @n: the decimal
+ * @precision: most limbs of the float's mantissa, 0 to keep them all
+ *
+ * Return: the float (free with free_infiX_float()), NULL on failure
+ */
+infiX_float *float_from_decimal(const infiX_decimal *n, size_t precision)
+{
+	size_t pad = 0;
+
+	if (!n)
+		return (NULL);
+
+	/*Round the scale up to whole limbs, 1.5 is 500000000 * 10^-9.*/
+	pad = (MAX_DIGITS_u4b - n->scale % MAX_DIGITS_u4b) % MAX_DIGITS_u4b;
+	return (round_float(infiX_shift_left(n->mantissa, pad),
+						-(ssize_t)((n->scale + pad) / MAX_DIGITS_u4b), precision));
+}
+
+/**
+ * float_to_decimal - convert a float to a decimal.
+ * @n: the float
+ *
+ * Description: the conversion is exact, a float with a negative exponent
+ * has 9 decimal places for each limb below the point.
+ *
+ * Return: the decimal (free with free_infiX_decimal()), NULL on failure
+ */
+infiX_decimal *float_to_decimal(const infiX_float *n)
+{
+	u4b_array *mantissa = NULL;
+	infiX_decimal *decimal = NULL;
+
+	if (!n)
+		return (NULL);
+
+	if (n->exponent < 0)
+		return (decimal_new(n->mantissa, -n->exponent * MAX_DIGITS_u4b));
+
+	mantissa = infiX_shift_left(n->mantissa, n->exponent * MAX_DIGITS_u4b);
+	if (mantissa)
+		decimal = decimal_new(mantissa, 0);
+
+	mantissa = free_u4b_array(mantissa);
+	return (decimal);
+}
+
+/**
+ * free_infiX_float - free a float.
+ * @n: the float, may be NULL
+ *
+ * Return: NULL always.
+ */
+void *free_infiX_float(infiX_float *n)
+{
+	if (!n)
+		return (NULL);
+
+	n->mantissa = free_u4b_array(n->mantissa);
+	return (free_n_null(n));
+}
+
+/**
+ * float_addition - add two floats.
+ * @n1: the first float
+ * @n2: the second float
+ * @precision: most limbs of the result, 0 for the larger of n1's and n2's
+ * precision
+ *
+ * Description: the result is the exact sum truncated towards zero, see
+ * add_floats().
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_float *float_addition(const infiX_float *n1, const infiX_float *n2, size_t precision)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (add_floats(infiX_addition, n1, n2, pick_precision(n1, n2, precision)));
+}
+
+/**
+ * float_subtraction - subtract two floats.
+ * @n1: the first float
+ * @n2: the float to subtract
+ * @precision: most limbs of the result, 0 for the larger of n1's and n2's
+ * precision
+ *
+ * Description: see float_addition().
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_float *float_subtraction(const infiX_float *n1, const infiX_float *n2,
+							   size_t precision)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (add_floats(infiX_subtraction, n1, n2, pick_precision(n1, n2, precision)));
+}
+
+/**
+ * float_multiplication - multiply two floats.
+ * @n1: the first float
+ * @n2: the second float
+ * @precision: most limbs of the result, 0 for the larger of n1's and n2's
+ * precision
+ *
+ * Description: only the top precision + 1 limbs of the product are computed
+ * with infiX_multiplication_high(), the result is the exact product
+ * truncated towards zero.
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_float *float_multiplication(const infiX_float *n1, const infiX_float *n2,
+								  size_t precision)
+{
+	size_t len = 0, drop = 0;
+
+	if (!n1 || !n2)
+		return (NULL);
+
+	precision = pick_precision(n1, n2, precision);
+	len = n1->mantissa->len + n2->mantissa->len;
+	if (len > precision + 1)
+		drop = len - precision - 1;
+
+	return (round_float(infiX_multiplication_high(n1->mantissa, n2->mantissa, drop),
+						n1->exponent + n2->exponent + drop, precision));
+}
+
+/**
+ * float_division - divide two floats.
+ * @n1: the numerator
+ * @n2: the denominator
+ * @precision: most limbs of the result, 0 for the larger of n1's and n2's
+ * precision
+ *
+ * Description: n1's mantissa is shifted (or truncated) so that the integer
+ * quotient of the mantissas has at least precision limbs, the result is the
+ * exact quotient truncated towards zero.
+ *
+ * Return: the result, NULL on failure or division by zero
+ */
+infiX_float *float_division(const infiX_float *n1, const infiX_float *n2,
+							size_t precision)
+{
+	u4b_array a = {0}, b = {0}, *numerator = NULL, *quotient = NULL;
+	ssize_t shift = 0;
+
+	if (!n1 || !n2)
+		return (NULL);
+
+	precision = pick_precision(n1, n2, precision);
+	a = slice_u4b_array(n1->mantissa, 0, n1->mantissa->len);
+	b = slice_u4b_array(n2->mantissa, 0, n2->mantissa->len);
+	a.is_negative = 0;
+	b.is_negative = 0;
+	shift = (ssize_t)precision + b.len - a.len + 1;
+	if (shift >= 0)
+		numerator = infiX_shift_left(&a, shift * MAX_DIGITS_u4b);
+	else
+		numerator = infiX_shift_right(&a, -shift * MAX_DIGITS_u4b);
+
+	if (numerator)
+		quotient = infiX_division(numerator, &b);
+
+	numerator = free_u4b_array(numerator);
+	if (quotient)
+		quotient->is_negative = (n1->mantissa->is_negative != n2->mantissa->is_negative);
+
+	return (round_float(quotient, n1->exponent - n2->exponent - shift, precision));
+}
+
+/**
+ * float_sqrt - the square root of a float.
+ * @n: the float, not negative
+ * @precision: most limbs of the result, 0 for n's precision
+ *
+ * Description: the mantissa is shifted (or truncated) to an even exponent
+ * and at least 2 * precision + 2 limbs, so its integer square root has more
+ * than precision limbs. The result is the exact root truncated.
+ *
+ * Return: the result, NULL on failure or if n is negative
+ */
+infiX_float *float_sqrt(const infiX_float *n, size_t precision)
+{
+	u4b_array *scaled = NULL, *root = NULL;
+	ssize_t shift = 0;
+
+	if (!n || n->mantissa->is_negative)
+		return (NULL);
+
+	precision = pick_precision(n, n, precision);
+	shift = 2 * (ssize_t)precision + 2 - n->mantissa->len;
+	if ((n->exponent - shift) % 2)
+		shift++;
+
+	if (shift >= 0)
+		scaled = infiX_shift_left(n->mantissa, shift * MAX_DIGITS_u4b);
+	else
+		scaled = infiX_shift_right(n->mantissa, -shift * MAX_DIGITS_u4b);
+
+	if (scaled)
+		root = isqrt(scaled);
+
+	scaled = free_u4b_array(scaled);
+	return (round_float(root, (n->exponent - shift) / 2, precision));
+}
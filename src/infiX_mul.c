@@ -1,7 +1,9 @@
 #include "infiX.h"
 
-static u4b_array *multiply_negatives(u4b_array *n1, u4b_array *n2)
-	ATTR_NONNULL;
+static u4b_array *multiply(u4b_array *dest, const u4b_array *n1, const u4b_array *n2)
+	ATTR_NONNULL_IDX(2, 3);
+static int multiply_sparse(uint32_t *rp, const uint32_t *up, size_t un,
+						   const uint32_t *vp, size_t vn) ATTR_NONNULL;
 
 /**
  * infiX_multiplication - multiplies numbers stored in arrays.
@@ -10,103 +12,224 @@ static u4b_array *multiply_negatives(u4b_array *n1, u4b_array *n2)
  *
  * Return: pointer to result, NULL on failure
  */
-u4b_array *infiX_multiplication(u4b_array *n1, u4b_array *n2)
+u4b_array *infiX_multiplication(const u4b_array *n1, const u4b_array *n2)
 {
-	int64_t byt_mul = 0;
-	size_t n1_i = 0, n2_i = 0;
-	u4b_array *product = NULL, *current_mul = NULL, *increment = NULL;
+	return (infiX_multiplication_into(NULL, n1, n2));
+}
+
+/**
+ * infiX_multiplication_into - multiplies numbers into a given array.
+ * @dest: array to store the product in, NULL to allocate a new one
+ * @n1: the first integer array (base 10)
+ * @n2: the second integer array (base 10)
+ *
+ * Description: dest's buffer is reused if it has enough capacity. If dest is
+ * the same struct as n1 or n2 the product is built in a new buffer which then
+ * replaces dest's. n1 and n2 are only read through views, so they are never
+ * modified (unless one is dest).
+ *
+ * Return: pointer to result, NULL on failure
+ */
+u4b_array *infiX_multiplication_into(u4b_array *dest, const u4b_array *n1, const u4b_array *n2)
+{
+	u4b_array *product = NULL, a = {0}, b = {0};
 
 	if (!n1 || !n2)
 		return (NULL);
 
-	trim_u4b_array(n1);
-	trim_u4b_array(n2);
-	if (n1->is_negative || n2->is_negative)
-		return (multiply_negatives(n1, n2));
+	if (dest && (dest == n1 || dest == n2))
+	{
+		/*The inputs are read until the very end, so work out of place.*/
+		product = infiX_multiplication_into(NULL, n1, n2);
+		return (product ? move_u4b_array(dest, product) : NULL);
+	}
 
-	/*Multiplication by zero.*/
-	if (!n1->len || !n2->len)
-		return (alloc_u4b_array(0));
-	else if ((n1->len == 1 && !n1->array[0]) || (n2->len == 1 && !n2->array[0]))
-		return (alloc_u4b_array(1));
+	/*Multiply the magnitudes, -8 * 7 = -(8*7) and -8 * -7 = 8*7.*/
+	a = slice_u4b_array(n1, 0, n1->len);
+	b = slice_u4b_array(n2, 0, n2->len);
+	trim_u4b_array(&a);
+	trim_u4b_array(&b);
+	a.is_negative = 0;
+	b.is_negative = 0;
+	product = multiply(dest, &a, &b);
+	if (product)
+	{
+		/*A zero product is never negative.*/
+		product->is_negative = (n1->is_negative != n2->is_negative);
+		trim_u4b_array(product);
+		ASSERT_NORMALIZED(product);
+	}
 
-	increment = alloc_u4b_array(0);
-	if (!increment)
+	return (product);
+}
+
+/**
+ * infiX_multiplication_high - multiplies numbers without the low limbs.
+ * @n1: the first integer array (base 10)
+ * @n2: the second integer array (base 10)
+ * @limbs: number of low limbs of the product to drop
+ *
+ * Description: the product is truncated towards zero, its magnitude is
+ * floor(|n1 * n2| / MAX_VAL_u4b^limbs). It is a short product from
+ * limbs_mul_high(), the dropped limbs are never computed except for
+ * MUL_HIGH_GUARD_LIMBS. Those tell whether the dropped part could have
+ * carried into the kept limbs, only then is the full product computed. The
+ * full product is also used when limbs_mul_high_wins() says it is cheaper.
+ *
+ * Return: pointer to result, NULL on failure
+ */
+u4b_array *infiX_multiplication_high(const u4b_array *n1, const u4b_array *n2,
+									 size_t limbs)
+{
+	u4b_array *product = NULL, a = {0}, b = {0};
+	size_t skip = 0, len = 0;
+
+	if (!n1 || !n2)
 		return (NULL);
 
-	/*Iterate over every number in n2 and multiply with every number in n1.*/
-	for (n2_i = 0; n2_i < n2->len; n2_i++)
+	a = slice_u4b_array(n1, 0, n1->len);
+	b = slice_u4b_array(n2, 0, n2->len);
+	trim_u4b_array(&a);
+	trim_u4b_array(&b);
+	if (!a.len || !b.len || a.len + b.len <= limbs)
+		return (alloc_u4b_array(1));
+
+	a.is_negative = 0;
+	b.is_negative = 0;
+	len = a.len + b.len - limbs;
+	if (limbs > MUL_HIGH_GUARD_LIMBS &&
+		limbs_mul_high_wins(a.len, b.len, limbs - MUL_HIGH_GUARD_LIMBS))
 	{
-		/*Skip multiplication by zero*/
-		if (n2->array[n2_i] == 0)
-			continue;
-
-		/*Length of current_mul = */
-		/*length of n1 + (number of digits between n2[0] and n2[n2_i])*/
-		current_mul = alloc_u4b_array(n1->len + n2_i + 1);
-		if (!current_mul)
-			return (free_u4b_array(product));
-
-		byt_mul = 0;
-		for (n1_i = 0; n1_i < n1->len; n1_i++)
-		{
-			byt_mul += (int64_t)n2->array[n2_i] * n1->array[n1_i];
-			current_mul->array[n2_i + n1_i] = byt_mul % MAX_VAL_u4b;
-			byt_mul /= MAX_VAL_u4b;
-		}
-
-		current_mul->array[n2_i + n1_i] = byt_mul;
-		product = infiX_addition(increment, current_mul);
-		current_mul = free_u4b_array(current_mul);
-		increment = free_u4b_array(increment);
+		skip = limbs - MUL_HIGH_GUARD_LIMBS;
+		product = alloc_u4b_array(len + MUL_HIGH_GUARD_LIMBS);
 		if (!product)
 			return (NULL);
 
-		increment = product;
+		limbs_mul_high(product->array, a.array, a.len, b.array, b.len, skip);
+		if (product->array[MUL_HIGH_GUARD_LIMBS - 1] == MAX_VAL_u4b - 1)
+			product = free_u4b_array(product);
 	}
 
+	if (!product)
+	{
+		product = multiply(NULL, &a, &b);
+		skip = 0;
+	}
+
+	if (!product)
+		return (NULL);
+
+	limbs_rshift(product->array, product->array, product->len, limbs - skip);
+	resize_u4b_array(product, len);
+	product->is_negative = (n1->is_negative != n2->is_negative);
 	trim_u4b_array(product);
+	ASSERT_NORMALIZED(product);
 	return (product);
 }
 
 /**
- * multiply_negatives - multiplication of signed numbers (-ve numbers) or zero
- * @n1: number to be multiplied
- * @n2: number to multiply
+ * multiply - multiplies the magnitudes of two numbers.
+ * @dest: array to store the product in, NULL to allocate a new one
+ * @n1: the first number, trimmed and not negative
+ * @n2: the second number, trimmed and not negative
  *
- * Return: pointer to the result, NULL on failure
+ * Description: low zero limbs of both numbers are skipped and added back to
+ * the product, so a power of ten (10^k is one limb after its zero limbs) costs
+ * a single limbs_mul_1() pass like infiX_shift_left(). Numbers that are mostly
+ * zero limbs are multiplied by multiply_sparse(), the rest by limbs_mul().
+ *
+ * Return: pointer to result, NULL on failure
  */
-u4b_array *multiply_negatives(u4b_array *n1, u4b_array *n2)
+u4b_array *multiply(u4b_array *dest, const u4b_array *n1, const u4b_array *n2)
 {
-	u4b_array *result = NULL;
+	size_t result_len = 0, z1 = 0, z2 = 0, itch = 0;
+	u4b_array *product = dest;
+	uint32_t *scratch = NULL;
 
-	if (n1->is_negative && n2->is_negative)
-	{
-		/* -8 * -7 = 8*7 */
-		n1->is_negative = 0;
-		n2->is_negative = 0;
-		result = infiX_multiplication(n1, n2);
-		n1->is_negative = 1;
-		n2->is_negative = 1;
-	}
-	else if (n1->is_negative)
-	{
-		/* -8 * 7 = -(8*7) */
-		n1->is_negative = 0;
-		result = infiX_multiplication(n1, n2);
-		n1->is_negative = 1;
-		if (result)
-			result->is_negative = 1;
-	}
-	else if (n2->is_negative)
+	/*Multiplication by zero.*/
+	if (!n1->len || !n2->len)
+		result_len = 0;
+	else if ((n1->len == 1 && !n1->array[0]) || (n2->len == 1 && !n2->array[0]))
+		result_len = 1;
+	else
+		result_len = n1->len + n2->len;
+
+	if (!product)
+		product = alloc_u4b_array(0);
+
+	if (!product)
+		return (NULL);
+
+	product->is_negative = 0;
+	if (resize_u4b_array(product, result_len))
+		return (product == dest ? NULL : free_u4b_array(product));
+
+	if (result_len == 1)
+		product->array[0] = 0;
+
+	if (result_len < 2)
+		return (product);
+
+	/*(a * B^z1) * (b * B^z2) = (a * b) * B^(z1 + z2)*/
+	while (!n1->array[z1])
+		z1++;
+
+	while (!n2->array[z2])
+		z2++;
+
+	memset(product->array, 0, sizeof(*product->array) * (z1 + z2));
+	if (!multiply_sparse(&product->array[z1 + z2], &n1->array[z1], n1->len - z1,
+						 &n2->array[z2], n2->len - z2))
+		return (product);
+
+	itch = limbs_mul_itch(n1->len - z1, n2->len - z2);
+	if (itch)
 	{
-		/* 8 * -7 = -(8*7) */
-		n2->is_negative = 0;
-		result = infiX_multiplication(n1, n2);
-		n2->is_negative = 1;
-		if (result)
-			result->is_negative = 1;
+		scratch = xmalloc(sizeof(*scratch) * itch);
+		if (!scratch)
+			return (product == dest ? NULL : free_u4b_array(product));
 	}
 
-	return (result);
+	limbs_mul(&product->array[z1 + z2], &n1->array[z1], n1->len - z1,
+			  &n2->array[z2], n2->len - z2, scratch);
+	scratch = free_n_null(scratch);
+	return (product);
+}
+
+/**
+ * multiply_sparse - multiply two limb vectors if they are mostly zero limbs.
+ * @rp: where to store the un + vn limbs of the product
+ * @up: the first vector, its top and bottom limbs are not zero
+ * @un: number of limbs in up
+ * @vp: the second vector, its top and bottom limbs are not zero
+ * @vn: number of limbs in vp
+ *
+ * Description: the runs of nonzero limbs in up are indexed for
+ * limbs_mul_sparse() when limbs_mul_sparse_wins() says so.
+ *
+ * Return: 0 if the product was stored, 1 if limbs_mul() should be used.
+ */
+int multiply_sparse(uint32_t *rp, const uint32_t *up, size_t un,
+					const uint32_t *vp, size_t vn)
+{
+	size_t *runs = NULL, nruns = 0, u_nonzero = 0, v_nonzero = 0;
+
+	/*Single limbs take one limbs_mul_1() pass anyway.*/
+	if (un < 2 || vn < 2)
+		return (1);
+
+	nruns = limbs_runs(NULL, up, un, &u_nonzero);
+	limbs_runs(NULL, vp, vn, &v_nonzero);
+	if (!limbs_mul_sparse_wins(un, u_nonzero, nruns, vn, v_nonzero))
+		return (1);
+
+	/*A failed allocation falls back to the dense product.*/
+	runs = xmalloc(sizeof(*runs) * nruns * 2);
+	if (!runs)
+		return (1);
+
+	limbs_runs(runs, up, un, NULL);
+	limbs_mul_sparse(rp, up, un, runs, nruns, vp, vn);
+	runs = free_n_null(runs);
+	return (0);
 }
@@ -0,0 +1,638 @@
+#include "infiX.h"
+
+static radix_powers *get_powers(unsigned int base);
+static const u4b_array *radix_power(radix_powers *p, size_t j) ATTR_NONNULL;
+static const u4b_array *radix_inverse(radix_powers *p, size_t j) ATTR_NONNULL;
+static u4b_array *refine_inverse(u4b_array *x, const u4b_array *d) ATTR_NONNULL_IDX(2);
+static int divmod_power(const u4b_array *n, radix_powers *p, size_t j,
+						u4b_array **q, u4b_array **r) ATTR_NONNULL;
+static int is_radix(unsigned int base);
+static uint16_t *parse_radix_str(const char *num_str, unsigned int base,
+								 size_t *len, char *is_negative) ATTR_NONNULL;
+static u4b_array *from_digits(const uint16_t *digits, size_t len,
+							  unsigned int base, radix_powers *p) ATTR_NONNULL;
+static int to_digits(uint16_t *digits, size_t width, const u4b_array *n,
+					 unsigned int base, radix_powers *p) ATTR_NONNULL;
+
+/*Digits of the bases up to 36, letters are written in lower case.*/
+static const char radix_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+/*The powers of every base, each thread keeps its own between calls. There*/
+/*are no bases 0 and 1, slot 0 holds RADIX_WORD_BASE.*/
+static _Thread_local radix_powers *radix_cache[37];
+
+/**
+ * is_radix - check that a base can be converted to and from.
+ * @base: the base
+ *
+ * Return: 1 for 2 to 36 and RADIX_WORD_BASE, else 0.
+ */
+int is_radix(unsigned int base)
+{
+	return ((base >= 2 && base <= 36) || base == RADIX_WORD_BASE);
+}
+
+/**
+ * get_powers - get the cached powers of a base.
+ * @base: the base, see is_radix()
+ *
+ * Return: the powers, NULL on failure
+ */
+radix_powers *get_powers(unsigned int base)
+{
+	size_t slot = base == RADIX_WORD_BASE ? 0 : base;
+	radix_powers *p = radix_cache[slot];
+
+	if (p)
+		return (p);
+
+	p = xcalloc(1, sizeof(*p));
+	if (!p)
+		return (NULL);
+
+	p->chunk = 1;
+	while ((uint64_t)p->chunk * base < MAX_VAL_u4b)
+	{
+		p->chunk *= base;
+		p->digits++;
+	}
+
+	radix_cache[slot] = p;
+	return (p);
+}
+
+/**
+ * radix_power - get chunk^(2^j) of a base.
+ * @p: the base's powers
+ * @j: which power
+ *
+ * Description: the powers below j that are missing are computed by squaring
+ * and cached with it.
+ *
+ * Return: the power, NULL on failure
+ */
+const u4b_array *radix_power(radix_powers *p, size_t j)
+{
+	u4b_array *power = NULL;
+
+	while (p->count <= j)
+	{
+		if (!p->count)
+		{
+			power = alloc_u4b_array(1);
+			if (power)
+				power->array[0] = p->chunk;
+		}
+		else
+			power = infiX_multiplication(p->powers[p->count - 1],
+										 p->powers[p->count - 1]);
+
+		if (!power)
+			return (NULL);
+
+		p->powers[p->count++] = power;
+	}
+
+	return (p->powers[j]);
+}
+
+/**
+ * radix_inverse - get the inverse of chunk^(2^j) of a base.
+ * @p: the base's powers
+ * @j: which power
+ *
+ * Description: 1 / chunk^(2^(j + 1)) is (1 / chunk^(2^j))^2, so each inverse
+ * is worked out from the one below it with a square and refine_inverse()
+ * instead of a long division. The inverses below j are cached with it.
+ *
+ * Return: the inverse, see struct radix_powers, NULL on failure
+ */
+const u4b_array *radix_inverse(radix_powers *p, size_t j)
+{
+	const u4b_array *power = radix_power(p, j), *below = NULL;
+	u4b_array *inverse = NULL, *square = NULL;
+	uint64_t value = 0;
+	size_t m = 0;
+
+	if (!power || p->inverses[j])
+		return (power ? p->inverses[j] : NULL);
+
+	if (!j)
+	{
+		value = (uint64_t)MAX_VAL_u4b * MAX_VAL_u4b / p->chunk;
+		inverse = alloc_u4b_array(2);
+		if (inverse)
+		{
+			inverse->array[0] = value % MAX_VAL_u4b;
+			inverse->array[1] = value / MAX_VAL_u4b;
+			trim_u4b_array(inverse);
+		}
+	}
+	else
+	{
+		below = radix_inverse(p, j - 1);
+		m = p->powers[j - 1]->len;
+		if (below)
+			square = infiX_multiplication(below, below);
+
+		/*B^(4m) / powers[j] scaled down to B^(2 * power->len) / powers[j].*/
+		if (square)
+			inverse = infiX_shift_right(square, (4 * m - 2 * power->len) * MAX_DIGITS_u4b);
+
+		square = free_u4b_array(square);
+		inverse = refine_inverse(inverse, power);
+	}
+
+	p->inverses[j] = inverse;
+	return (inverse);
+}
+
+/**
+ * refine_inverse - correct an approximate inverse.
+ * @x: about B^(2m) / d, it is taken over (freed on failure), may be NULL
+ * @d: the number to invert, m limbs
+ *
+ * Description: x is the square of the inverse below, its relative error is
+ * about 2 / B^(m / 2). One Newton step x += x * (B^(2m) - d * x) / B^(2m)
+ * squares that, which leaves x within a few units of B^(2m) / d. The rest is
+ * fixed by moving d between x * d and the remainder.
+ *
+ * Return: floor(B^(2m) / d), NULL on failure
+ */
+u4b_array *refine_inverse(u4b_array *x, const u4b_array *d)
+{
+	uint32_t one[] = {1};
+	u4b_array unit = {1, 0, 0, one}, *top = NULL, *e = NULL, *t = NULL;
+	int failed = 0;
+
+	top = alloc_u4b_array(2 * d->len + 1);
+	if (x && top)
+	{
+		/*e = B^(2m) - d * x*/
+		top->array[2 * d->len] = 1;
+		t = infiX_multiplication(d, x);
+		e = t ? infiX_subtraction(top, t) : NULL;
+		t = free_u4b_array(t);
+		t = e ? infiX_multiplication(x, e) : NULL;
+		e = free_u4b_array(e);
+		if (t && infiX_shift_right_into(t, t, 2 * d->len * MAX_DIGITS_u4b) &&
+			infiX_addition_into(x, x, t) && infiX_multiplication_into(t, d, x) &&
+			infiX_subtraction_into(t, top, t))
+		{
+			e = t;
+			t = NULL;
+		}
+
+		t = free_u4b_array(t);
+	}
+
+	failed = !e;
+	while (!failed && e->is_negative)
+		failed = !infiX_subtraction_into(x, x, &unit) || !infiX_addition_into(e, e, d);
+
+	while (!failed && cmp_u4barray(e, d) >= 0)
+		failed = !infiX_addition_into(x, x, &unit) || !infiX_subtraction_into(e, e, d);
+
+	top = free_u4b_array(top);
+	e = free_u4b_array(e);
+	if (failed)
+		x = free_u4b_array(x);
+
+	return (x);
+}
+
+/**
+ * divmod_power - divide by chunk^(2^j) of a base.
+ * @n: the numerator, not negative and less than the power squared
+ * @p: the base's powers
+ * @j: which power
+ * @q: where to store the quotient
+ * @r: where to store the remainder
+ *
+ * Description: Barrett's reduction, the top limbs of n times the power's
+ * inverse are at most 2 short of the quotient, so a division costs two
+ * multiplications and at most two subtractions.
+ *
+ * Return: 0 on success, -1 on failure (nothing is stored)
+ */
+int divmod_power(const u4b_array *n, radix_powers *p, size_t j,
+				 u4b_array **q, u4b_array **r)
+{
+	const u4b_array *power = radix_power(p, j), *inverse = radix_inverse(p, j);
+	uint32_t one[] = {1};
+	u4b_array unit = {1, 0, 0, one}, top = {0}, *t = NULL;
+	size_t m = 0;
+	int failed = 0;
+
+	*q = NULL;
+	*r = NULL;
+	if (!power || !inverse)
+		return (-1);
+
+	m = power->len;
+	if (n->len < m)
+	{
+		*q = alloc_u4b_array(1);
+		*r = dup_u4b_array(n);
+	}
+	else
+	{
+		top = slice_u4b_array(n, m - 1, n->len - m + 1);
+		t = infiX_multiplication(&top, inverse);
+		*q = t ? infiX_shift_right(t, (m + 1) * MAX_DIGITS_u4b) : NULL;
+		t = free_u4b_array(t);
+		t = *q ? infiX_multiplication(*q, power) : NULL;
+		*r = t ? infiX_subtraction(n, t) : NULL;
+		t = free_u4b_array(t);
+	}
+
+	failed = !*q || !*r;
+	while (!failed && cmp_u4barray(*r, power) >= 0)
+		failed = !infiX_subtraction_into(*r, *r, power) ||
+				 !infiX_addition_into(*q, *q, &unit);
+
+	if (failed)
+	{
+		*q = free_u4b_array(*q);
+		*r = free_u4b_array(*r);
+		return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * parse_radix_str - read the digits of a number in a given base.
+ * @num_str: a string of digits in base, may start with a '-'
+ * @base: the base, 2 to 36
+ * @len: where to store the number of digits
+ * @is_negative: where to store the sign
+ *
+ * Description: leading zeros, ',' and ' ' are skipped like in
+ * parse_numstr(). Letters are digits from 10 up, in either case.
+ *
+ * Return: the digits' values, most significant first, NULL on failure or if
+ * there is no digit at all (e.g. "", "-" or ",")
+ */
+uint16_t *parse_radix_str(const char *num_str, unsigned int base,
+						  size_t *len, char *is_negative)
+{
+	uint16_t *digits = NULL;
+	unsigned int d = 0;
+	size_t i = 0;
+	char seen = 0;
+
+	*len = 0;
+	*is_negative = (num_str[0] == '-');
+	num_str += *is_negative;
+	digits = xmalloc(sizeof(*digits) * (strlen(num_str) + 1));
+	if (!digits)
+		return (NULL);
+
+	for (i = 0; num_str[i]; i++)
+	{
+		if (num_str[i] == ',' || num_str[i] == ' ')
+			continue;
+
+		if (num_str[i] >= '0' && num_str[i] <= '9')
+			d = num_str[i] - '0';
+		else if (isalpha((unsigned char)num_str[i]))
+			d = tolower((unsigned char)num_str[i]) - 'a' + 10;
+		else
+			d = UINT16_MAX;
+
+		if (d >= base)
+		{
+			if (d == UINT16_MAX)
+				panic("invalid char");
+			else
+				panic_digit(num_str[i], base);
+
+			return (free_n_null(digits));
+		}
+
+		/*Leading zeros are dropped.*/
+		seen = 1;
+		if (*len || d)
+			digits[(*len)++] = d;
+	}
+
+	if (!seen)
+	{
+		panic("digits");
+		return (free_n_null(digits));
+	}
+
+	return (digits);
+}
+
+/**
+ * from_digits - convert digits in a base to a u4b_array.
+ * @digits: the digits' values, most significant first
+ * @len: number of digits, not 0
+ * @base: the base
+ * @p: the base's powers
+ *
+ * Description: short numbers are read one chunk of p->digits digits at a
+ * time. Longer ones are split so the low part has a power of two number of
+ * chunks, the result is then high * chunk^(2^j) + low and the halves are
+ * converted the same way. The cost is that of the few multiplications at the
+ * top.
+ *
+ * Return: the number, NULL on failure
+ */
+u4b_array *from_digits(const uint16_t *digits, size_t len, unsigned int base,
+					   radix_powers *p)
+{
+	size_t chunks = (len + p->digits - 1) / p->digits, c = 0, i = 0, end = 0, j = 0;
+	u4b_array *high = NULL, *low = NULL, *result = NULL;
+	const u4b_array *power = NULL;
+	uint32_t value = 0;
+
+	if (chunks <= RADIX_DC_LIMBS)
+	{
+		result = alloc_u4b_array(chunks);
+		if (!result)
+			return (NULL);
+
+		/*The first chunk takes the digits left over by the rest.*/
+		end = len - (chunks - 1) * p->digits;
+		for (c = 0; c < chunks; c++, end += p->digits)
+		{
+			for (value = 0; i < end; i++)
+				value = value * base + digits[i];
+
+			result->array[c] = limbs_mul_1(result->array, result->array, c,
+										   p->chunk);
+			limbs_add(result->array, result->array, c + 1, &value, 1);
+		}
+
+		trim_u4b_array(result);
+		return (result);
+	}
+
+	while (((size_t)2 << j) < chunks)
+		j++;
+
+	power = radix_power(p, j);
+	high = from_digits(digits, len - (p->digits << j), base, p);
+	low = from_digits(&digits[len - (p->digits << j)], p->digits << j, base, p);
+	if (power && high && low)
+		result = infiX_multiplication(high, power);
+
+	if (result && !infiX_addition_into(result, result, low))
+		result = free_u4b_array(result);
+
+	high = free_u4b_array(high);
+	low = free_u4b_array(low);
+	return (result);
+}
+
+/**
+ * to_digits - write a u4b_array's digits in a base.
+ * @digits: where to write the digits' values, most significant first
+ * @width: number of digits to write, n must be less than base^width
+ * @n: the number, not negative
+ * @base: the base
+ * @p: the base's powers
+ *
+ * Description: the digits are padded with leading zeros up to width. Short
+ * numbers are divided by p->chunk repeatedly, longer ones are divided by the
+ * chunk^(2^j) that leaves the remainder about half of width and the quotient
+ * and remainder are written the same way.
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int to_digits(uint16_t *digits, size_t width, const u4b_array *n,
+			  unsigned int base, radix_powers *p)
+{
+	uint32_t limbs[RADIX_DC_LIMBS] = {0}, rem = 0;
+	size_t len = n->len, chunks = (width + p->digits - 1) / p->digits, d = 0, j = 0;
+	u4b_array *q = NULL, *r = NULL;
+	int status = -1;
+
+	if (len <= RADIX_DC_LIMBS)
+	{
+		if (len)
+			memcpy(limbs, n->array, sizeof(*limbs) * len);
+
+		while (width)
+		{
+			rem = len ? limbs_divrem_1(limbs, limbs, len, p->chunk) : 0;
+			while (len && !limbs[len - 1])
+				len--;
+
+			for (d = 0; d < p->digits && width; d++, rem /= base)
+				digits[--width] = rem % base;
+		}
+
+		return (0);
+	}
+
+	while (((size_t)2 << j) < chunks)
+		j++;
+
+	if (!divmod_power(n, p, j, &q, &r) &&
+		!to_digits(digits, width - (p->digits << j), q, base, p) &&
+		!to_digits(&digits[width - (p->digits << j)], p->digits << j, r, base, p))
+		status = 0;
+
+	q = free_u4b_array(q);
+	r = free_u4b_array(r);
+	return (status);
+}
+
+/**
+ * radix_digits_to_intarray - convert digit values in a base to a u4b_array.
+ * @digits: the digits' values, most significant first, each less than base
+ * @len: number of digits, 0 for zero
+ * @base: the base, 2 to 36 or RADIX_WORD_BASE
+ *
+ * Description: long numbers are converted by divide and conquer with the
+ * powers of base cached by the thread, see free_radix_powers().
+ *
+ * Return: pointer to a normalized, not negative u4b_array, NULL on failure
+ */
+u4b_array *radix_digits_to_intarray(const uint16_t *digits, size_t len,
+									unsigned int base)
+{
+	radix_powers *p = NULL;
+	u4b_array *arr = NULL;
+
+	if (!is_radix(base) || (len && !digits))
+		return (NULL);
+
+	/*Leading zeros would only make the halves uneven.*/
+	while (len && !digits[0])
+	{
+		digits++;
+		len--;
+	}
+
+	if (!len)
+		return (alloc_u4b_array(1));
+
+	p = get_powers(base);
+	if (p)
+		arr = from_digits(digits, len, base, p);
+
+	ASSERT_NORMALIZED(arr);
+	return (arr);
+}
+
+/**
+ * intarr_to_radix_digits - convert a u4b_array to digit values in a base.
+ * @arr: the u4b_array, its sign is ignored
+ * @base: the base, 2 to 36 or RADIX_WORD_BASE
+ * @len: where to store the number of digits
+ *
+ * Description: long numbers are converted by divide and conquer with the
+ * powers of base cached by the thread, see free_radix_powers().
+ *
+ * Return: the digits' values, most significant first and without leading
+ * zeros (zero is one 0 digit), NULL on failure
+ */
+uint16_t *intarr_to_radix_digits(const u4b_array *arr, unsigned int base, size_t *len)
+{
+	u4b_array num = {0};
+	radix_powers *p = NULL;
+	uint16_t *digits = NULL;
+	size_t width = 0, start = 0;
+
+	if (!arr || !len || !is_radix(base))
+		return (NULL);
+
+	num = slice_u4b_array(arr, 0, arr->len);
+	trim_u4b_array(&num);
+	num.is_negative = 0;
+	p = get_powers(base);
+	/*MAX_VAL_u4b^len has at most this many digits in base.*/
+	width = (size_t)(num.len * MAX_DIGITS_u4b * log(10) / log(base)) + 2;
+	if (p)
+		digits = xmalloc(sizeof(*digits) * width);
+
+	if (!digits || to_digits(digits, width, &num, base, p))
+		return (free_n_null(digits));
+
+	while (start < width - 1 && !digits[start])
+		start++;
+
+	*len = width - start;
+	memmove(digits, &digits[start], sizeof(*digits) * *len);
+	return (digits);
+}
+
+/**
+ * radix_to_intarray - convert a string of digits in any base to a u4b_array.
+ * @num_str: a string of digits in base, may start with a '-'
+ * @base: the base, 2 to 36
+ *
+ * Description: digits past 9 are letters in either case, ',' and ' ' are
+ * ignored. See radix_digits_to_intarray(). NULL converts to 0.
+ *
+ * Return: pointer to a normalized u4b_array, NULL on failure, if a digit is
+ * not valid in base or if there are no digits (e.g. after "0x")
+ */
+u4b_array *radix_to_intarray(const char *num_str, unsigned int base)
+{
+	uint16_t *digits = NULL;
+	u4b_array *arr = NULL;
+	size_t len = 0;
+	char is_negative = 0;
+
+	if (base < 2 || base > 36)
+	{
+		panic("base");
+		return (NULL);
+	}
+
+	if (!num_str)
+		return (alloc_u4b_array(1));
+
+	digits = parse_radix_str(num_str, base, &len, &is_negative);
+	if (!digits)
+		return (NULL);
+
+	arr = radix_digits_to_intarray(digits, len, base);
+	digits = free_n_null(digits);
+	if (arr)
+	{
+		arr->is_negative = is_negative;
+		trim_u4b_array(arr);
+	}
+
+	return (arr);
+}
+
+/**
+ * intarr_to_radix - convert a u4b_array to a string of digits in any base.
+ * @arr: the u4b_array
+ * @base: the base, 2 to 36
+ *
+ * Description: digits past 9 are written as lower case letters. See
+ * intarr_to_radix_digits().
+ *
+ * Return: a pointer to the string, NULL on failure
+ */
+char *intarr_to_radix(const u4b_array *arr, unsigned int base)
+{
+	uint16_t *digits = NULL;
+	size_t len = 0, i = 0, w = 0;
+	char *num_str = NULL;
+
+	if (!arr)
+		return (NULL);
+
+	if (base < 2 || base > 36)
+	{
+		panic("base");
+		return (NULL);
+	}
+
+	digits = intarr_to_radix_digits(arr, base, &len);
+	if (digits)
+		num_str = xmalloc(1 + len + 1);
+
+	if (num_str)
+	{
+		if (arr->is_negative && (len > 1 || digits[0]))
+			num_str[w++] = '-';
+
+		for (i = 0; i < len; i++)
+			num_str[w++] = radix_digits[digits[i]];
+
+		num_str[w] = '\0';
+	}
+
+	digits = free_n_null(digits);
+	return (num_str);
+}
+
+/**
+ * free_radix_powers - free the powers cached by the calling thread.
+ *
+ * Description: the radix conversions keep the powers of each base they
+ * convert with, so converting another number in that base costs no more
+ * squarings. Every thread that converts should call this before it exits
+ * and before it changes its allocator hooks.
+ */
+void free_radix_powers(void)
+{
+	radix_powers *p = NULL;
+	size_t slot = 0, j = 0;
+
+	for (slot = 0; slot < sizeof(radix_cache) / sizeof(*radix_cache); slot++)
+	{
+		p = radix_cache[slot];
+		if (!p)
+			continue;
+
+		for (j = 0; j < p->count; j++)
+		{
+			p->powers[j] = free_u4b_array(p->powers[j]);
+			p->inverses[j] = free_u4b_array(p->inverses[j]);
+		}
+
+		radix_cache[slot] = free_n_null(p);
+	}
+}
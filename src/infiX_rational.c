@@ -0,0 +1,583 @@
+#include "infiX.h"
+
+static infiX_rational *wrap_fraction(u4b_array *num, u4b_array *den, char is_reduced);
+static void maybe_reduce(infiX_rational *n) ATTR_NONNULL;
+static int is_one(const u4b_array *n) ATTR_NONNULL;
+static int lehmer_cofactors(int64_t x, int64_t y, int64_t *cof) ATTR_NONNULL;
+static u4b_array *combine(const u4b_array *a, int64_t x, const u4b_array *b, int64_t y)
+	ATTR_NONNULL;
+static infiX_rational *add_fractions(math_function *f, const infiX_rational *n1,
+									 const infiX_rational *n2) ATTR_NONNULL;
+static infiX_rational *multiply_fractions(const u4b_array *a, const u4b_array *b,
+										  const u4b_array *c, const u4b_array *d,
+										  char is_reduced) ATTR_NONNULL;
+
+/**
+ * wrap_fraction - make a rational out of a numerator and a denominator.
+ * @num: the numerator, the rational takes it over (freed on failure), may be
+ * NULL
+ * @den: the denominator, not zero, the rational takes it over (freed on
+ * failure), may be NULL
+ * @is_reduced: 1 if num and den have no common factor
+ *
+ * Description: the sign of den is moved to num, then the rational is
+ * reduced if it has grown past RATIONAL_REDUCE_LIMBS.
+ *
+ * Return: the rational, NULL on failure
+ */
+infiX_rational *wrap_fraction(u4b_array *num, u4b_array *den, char is_reduced)
+{
+	infiX_rational *n = NULL;
+
+	if (num && den)
+		n = xcalloc(1, sizeof(*n));
+
+	if (!n)
+	{
+		num = free_u4b_array(num);
+		den = free_u4b_array(den);
+		return (NULL);
+	}
+
+	num->is_negative = (num->is_negative != den->is_negative);
+	den->is_negative = 0;
+	trim_u4b_array(num);
+	trim_u4b_array(den);
+	n->num = num;
+	n->den = den;
+	n->is_reduced = is_reduced;
+	maybe_reduce(n);
+	return (n);
+}
+
+/**
+ * maybe_reduce - reduce a rational if it has grown too long.
+ * @n: the rational
+ *
+ * Description: a failed reduction leaves n as it was, still exact.
+ */
+void maybe_reduce(infiX_rational *n)
+{
+	if (!n->is_reduced && n->num->len + n->den->len > RATIONAL_REDUCE_LIMBS)
+		rational_reduce(n);
+}
+
+/**
+ * is_one - check if a number is 1.
+ * @n: the number, normalized
+ *
+ * Return: 1 if n is 1, else 0.
+ */
+int is_one(const u4b_array *n)
+{
+	return (n->len == 1 && n->array[0] == 1 && !n->is_negative);
+}
+
+/**
+ * add_fractions - add or subtract two rationals.
+ * @f: infiX_addition or infiX_subtraction
+ * @n1: the first rational
+ * @n2: the second rational
+ *
+ * Description: a/b + c/d = (a * d + c * b) / (b * d) without any GCD, and
+ * (a + c) / b when the denominators are equal.
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_rational *add_fractions(math_function *f, const infiX_rational *n1,
+							  const infiX_rational *n2)
+{
+	u4b_array *ad = NULL, *cb = NULL, *num = NULL, *den = NULL;
+
+	if (!cmp_u4barray(n1->den, n2->den))
+		return (wrap_fraction(f(n1->num, n2->num), dup_u4b_array(n1->den), 0));
+
+	ad = infiX_multiplication(n1->num, n2->den);
+	cb = infiX_multiplication(n2->num, n1->den);
+	if (ad && cb)
+	{
+		num = f(ad, cb);
+		if (num)
+			den = infiX_multiplication(n1->den, n2->den);
+	}
+
+	ad = free_u4b_array(ad);
+	cb = free_u4b_array(cb);
+	return (wrap_fraction(num, den, 0));
+}
+
+/**
+ * multiply_fractions - multiply two fractions with cross cancellation.
+ * @a: the first numerator
+ * @b: the first denominator
+ * @c: the second numerator
+ * @d: the second denominator
+ * @is_reduced: 1 if a / b and c / d are both reduced
+ *
+ * Description: a/b * c/d. Small products are left unreduced. Once the
+ * result would pass RATIONAL_REDUCE_LIMBS, a and d are divided by their GCD
+ * and so are c and b before multiplying. Those GCDs are of the operands'
+ * halves rather than of the whole product, and the product of reduced
+ * fractions cancelled this way is already reduced.
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_rational *multiply_fractions(const u4b_array *a, const u4b_array *b,
+								   const u4b_array *c, const u4b_array *d,
+								   char is_reduced)
+{
+	u4b_array *g1 = NULL, *g2 = NULL, *num = NULL, *den = NULL;
+	u4b_array *a_g = NULL, *b_g = NULL, *c_g = NULL, *d_g = NULL;
+
+	if (a->len + b->len + c->len + d->len <= RATIONAL_REDUCE_LIMBS)
+		return (wrap_fraction(infiX_multiplication(a, c), infiX_multiplication(b, d),
+							  0));
+
+	g1 = infiX_gcd(a, d);
+	g2 = infiX_gcd(c, b);
+	if (g1 && g2)
+	{
+		a_g = infiX_divexact(a, g1);
+		d_g = infiX_divexact(d, g1);
+		c_g = infiX_divexact(c, g2);
+		b_g = infiX_divexact(b, g2);
+	}
+
+	if (a_g && b_g && c_g && d_g)
+	{
+		num = infiX_multiplication(a_g, c_g);
+		den = infiX_multiplication(b_g, d_g);
+	}
+
+	g1 = free_u4b_array(g1);
+	g2 = free_u4b_array(g2);
+	a_g = free_u4b_array(a_g);
+	b_g = free_u4b_array(b_g);
+	c_g = free_u4b_array(c_g);
+	d_g = free_u4b_array(d_g);
+	return (wrap_fraction(num, den, is_reduced));
+}
+
+/**
+ * lehmer_cofactors - simulate Euclid's algorithm on the top limbs of 2 numbers.
+ * @x: the top 2 limbs of the larger number
+ * @y: the limbs of the smaller number in the same positions
+ * @cof: where to store the cofactors A, B, C and D
+ *
+ * Description: Lehmer's algorithm, the steps are taken while the quotient
+ * is the same for the smallest and largest values the full numbers could
+ * have, so a' = A * a + B * b and b' = C * a + D * b are the numbers Euclid's
+ * algorithm would have reached. The cofactors are kept below MAX_VAL_u4b.
+ *
+ * Return: 1 if at least one step was simulated, 0 if a full division step
+ * is needed.
+ */
+int lehmer_cofactors(int64_t x, int64_t y, int64_t *cof)
+{
+	int64_t a = 1, b = 0, c = 0, d = 1, q = 0, t = 0;
+
+	while (y + c && y + d)
+	{
+		q = (x + a) / (y + c);
+		if (q != (x + b) / (y + d) || q >= MAX_VAL_u4b)
+			break;
+
+		if (a - q * c <= -MAX_VAL_u4b || a - q * c >= MAX_VAL_u4b ||
+			b - q * d <= -MAX_VAL_u4b || b - q * d >= MAX_VAL_u4b)
+			break;
+
+		t = a - q * c;
+		a = c;
+		c = t;
+		t = b - q * d;
+		b = d;
+		d = t;
+		t = x - q * y;
+		x = y;
+		y = t;
+	}
+
+	cof[0] = a;
+	cof[1] = b;
+	cof[2] = c;
+	cof[3] = d;
+	return (b != 0);
+}
+
+/**
+ * combine - a linear combination of 2 numbers with small factors.
+ * @a: the first number
+ * @x: its factor, |x| < MAX_VAL_u4b
+ * @b: the second number
+ * @y: its factor, |y| < MAX_VAL_u4b
+ *
+ * Return: x * a + y * b, NULL on failure
+ */
+u4b_array *combine(const u4b_array *a, int64_t x, const u4b_array *b, int64_t y)
+{
+	uint32_t x_limb[] = {x < 0 ? -x : x}, y_limb[] = {y < 0 ? -y : y};
+	u4b_array x_arr = {.len = 1, .is_negative = x < 0, .array = x_limb};
+	u4b_array y_arr = {.len = 1, .is_negative = y < 0, .array = y_limb};
+	u4b_array *xa = infiX_multiplication(a, &x_arr), *yb = infiX_multiplication(b, &y_arr);
+	u4b_array *sum = NULL;
+
+	if (xa && yb)
+		sum = infiX_addition(xa, yb);
+
+	xa = free_u4b_array(xa);
+	yb = free_u4b_array(yb);
+	return (sum);
+}
+
+/**
+ * infiX_gcd - the greatest common divisor of two numbers.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Description: Euclid's algorithm sped up with Lehmer's, most steps are
+ * worked out on the top 2 limbs (see lehmer_cofactors()) and applied to the
+ * full numbers in one pass. It finishes with machine words once the smaller
+ * number fits in a limb. The signs are ignored and gcd(0, 0) is 0.
+ *
+ * Return: pointer to the (non negative) gcd, NULL on failure
+ */
+u4b_array *infiX_gcd(const u4b_array *n1, const u4b_array *n2)
+{
+	u4b_array *a = NULL, *b = NULL, *r = NULL, *next_b = NULL;
+	uint32_t x = 0, y = 0, t = 0;
+	int64_t cof[4] = {0}, top_a = 0, top_b = 0;
+	size_t n = 0;
+
+	if (!n1 || !n2)
+		return (NULL);
+
+	a = dup_u4b_array(n1);
+	b = dup_u4b_array(n2);
+	if (!a || !b)
+	{
+		a = free_u4b_array(a);
+		return (free_u4b_array(b));
+	}
+
+	a->is_negative = 0;
+	b->is_negative = 0;
+	trim_u4b_array(a);
+	trim_u4b_array(b);
+	if (cmp_u4barray(a, b) < 0)
+	{
+		r = a;
+		a = b;
+		b = r;
+	}
+
+	while (b->len > 1 || (b->len && b->array[0]))
+	{
+		if (b->len == 1 && !infiX_residue(a, b->array[0], &x))
+		{
+			/*gcd(a, y) = gcd(y, a % y) in machine words.*/
+			for (y = b->array[0]; x; y = t)
+			{
+				t = x;
+				x = y % x;
+			}
+
+			a = free_u4b_array(a);
+			b = free_u4b_array(b);
+			b = alloc_u4b_array(1);
+			if (b)
+				b->array[0] = y;
+
+			return (b);
+		}
+
+		n = a->len;
+		top_a = (int64_t)a->array[n - 1] * MAX_VAL_u4b + a->array[n - 2];
+		top_b = b->len < n - 1 ? 0 : (int64_t)(b->len == n ? b->array[n - 1] : 0) *
+			MAX_VAL_u4b + b->array[n - 2];
+		if (lehmer_cofactors(top_a, top_b, cof))
+		{
+			r = combine(a, cof[0], b, cof[1]);
+			next_b = combine(a, cof[2], b, cof[3]);
+			a = free_u4b_array(a);
+			b = free_u4b_array(b);
+			if (!r || !next_b)
+			{
+				r = free_u4b_array(r);
+				return (free_u4b_array(next_b));
+			}
+
+			a = r;
+			b = next_b;
+			continue;
+		}
+
+		r = infiX_modulus(a, b);
+		a = free_u4b_array(a);
+		if (!r)
+			return (free_u4b_array(b));
+
+		a = b;
+		b = r;
+	}
+
+	b = free_u4b_array(b);
+	return (a);
+}
+
+/**
+ * rational_new - make a rational from a numerator and a denominator.
+ * @num: the numerator, it is copied
+ * @den: the denominator, it is copied
+ *
+ * Return: the rational (free with free_infiX_rational()), NULL on failure or
+ * if den is zero
+ */
+infiX_rational *rational_new(const u4b_array *num, const u4b_array *den)
+{
+	u4b_array view = {0};
+
+	if (!num || !den)
+		return (NULL);
+
+	view = slice_u4b_array(den, 0, den->len);
+	trim_u4b_array(&view);
+	if (!view.len || (view.len == 1 && !view.array[0]))
+		return (NULL);
+
+	return (wrap_fraction(dup_u4b_array(num), dup_u4b_array(den), 0));
+}
+
+/**
+ * rational_from_str - convert a "num/den" string to a rational.
+ * @num_str: a string of numbers as for str_to_intarray(), optionally
+ * followed by a '/' and a denominator
+ *
+ * Return: the rational (free with free_infiX_rational()), NULL on failure or
+ * if the denominator is zero
+ */
+infiX_rational *rational_from_str(const char *num_str)
+{
+	char *copy = NULL, *slash = NULL;
+	u4b_array *num = NULL, *den = NULL;
+	infiX_rational *n = NULL;
+
+	if (!num_str)
+		return (NULL);
+
+	copy = xmalloc(strlen(num_str) + 1);
+	if (!copy)
+		return (NULL);
+
+	strcpy(copy, num_str);
+	slash = strchr(copy, '/');
+	if (slash)
+		*slash = '\0';
+
+	num = str_to_intarray(copy);
+	den = str_to_intarray(slash ? &slash[1] : "1");
+	if (num && den)
+		n = rational_new(num, den);
+
+	copy = free_n_null(copy);
+	num = free_u4b_array(num);
+	den = free_u4b_array(den);
+	return (n);
+}
+
+/**
+ * rational_to_str - convert a rational to a "num/den" string.
+ * @n: the rational, it is reduced first
+ *
+ * Return: a pointer to the string ("num" alone if den is 1), NULL on failure
+ */
+char *rational_to_str(infiX_rational *n)
+{
+	char *num = NULL, *den = NULL, *num_str = NULL;
+
+	if (!n || rational_reduce(n))
+		return (NULL);
+
+	num = intarr_to_str(n->num);
+	if (!num || is_one(n->den))
+		return (num);
+
+	den = intarr_to_str(n->den);
+	if (den)
+		num_str = xmalloc(strlen(num) + 1 + strlen(den) + 1);
+
+	if (num_str)
+		sprintf(num_str, "%s/%s", num, den);
+
+	num = free_n_null(num);
+	den = free_n_null(den);
+	return (num_str);
+}
+
+/**
+ * free_infiX_rational - free a rational.
+ * @n: the rational, may be NULL
+ *
+ * Return: NULL always.
+ */
+void *free_infiX_rational(infiX_rational *n)
+{
+	if (!n)
+		return (NULL);
+
+	n->num = free_u4b_array(n->num);
+	n->den = free_u4b_array(n->den);
+	return (free_n_null(n));
+}
+
+/**
+ * rational_reduce - put a rational in lowest terms.
+ * @n: the rational
+ *
+ * Description: the arithmetic functions only reduce their results when they
+ * grow past RATIONAL_REDUCE_LIMBS, call this to reduce at other times.
+ *
+ * Return: 0 on success, -1 on failure (n is unchanged)
+ */
+int rational_reduce(infiX_rational *n)
+{
+	u4b_array *g = NULL, *num = NULL, *den = NULL;
+
+	if (!n)
+		return (-1);
+
+	if (n->is_reduced)
+		return (0);
+
+	g = infiX_gcd(n->num, n->den);
+	if (g && !is_one(g))
+	{
+		num = infiX_divexact(n->num, g);
+		den = infiX_divexact(n->den, g);
+		if (!num || !den)
+		{
+			g = free_u4b_array(g);
+			num = free_u4b_array(num);
+			den = free_u4b_array(den);
+			return (-1);
+		}
+
+		n->num = move_u4b_array(n->num, num);
+		n->den = move_u4b_array(n->den, den);
+	}
+
+	if (!g)
+		return (-1);
+
+	g = free_u4b_array(g);
+	n->is_reduced = 1;
+	return (0);
+}
+
+/**
+ * cmp_rational - compare 2 rationals.
+ * @n1: the first rational
+ * @n2: the second rational
+ *
+ * Description: a/b and c/d compare like a * d and c * b, so neither needs
+ * to be reduced.
+ *
+ * Return: +ve number if n1 > n2, -ve number if n1 < n2 else 0 (also on
+ * failure).
+ */
+ssize_t cmp_rational(const infiX_rational *n1, const infiX_rational *n2)
+{
+	u4b_array *ad = NULL, *cb = NULL;
+	ssize_t cmp = 0;
+
+	if (!n1 || !n2)
+		return (0);
+
+	if (n1->num->is_negative != n2->num->is_negative)
+		return (n1->num->is_negative ? -1 : 1);
+
+	if (!cmp_u4barray(n1->den, n2->den))
+		return (cmp_u4barray(n1->num, n2->num));
+
+	ad = infiX_multiplication(n1->num, n2->den);
+	cb = infiX_multiplication(n2->num, n1->den);
+	if (ad && cb)
+		cmp = cmp_u4barray(ad, cb);
+
+	ad = free_u4b_array(ad);
+	cb = free_u4b_array(cb);
+	return (cmp);
+}
+
+/**
+ * rational_addition - add two rationals.
+ * @n1: the first rational
+ * @n2: the second rational
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_rational *rational_addition(const infiX_rational *n1, const infiX_rational *n2)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (add_fractions(infiX_addition, n1, n2));
+}
+
+/**
+ * rational_subtraction - subtract two rationals.
+ * @n1: the first rational
+ * @n2: the rational to subtract
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_rational *rational_subtraction(const infiX_rational *n1, const infiX_rational *n2)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (add_fractions(infiX_subtraction, n1, n2));
+}
+
+/**
+ * rational_multiplication - multiply two rationals.
+ * @n1: the first rational
+ * @n2: the second rational
+ *
+ * Description: see multiply_fractions().
+ *
+ * Return: the result, NULL on failure
+ */
+infiX_rational *rational_multiplication(const infiX_rational *n1,
+										const infiX_rational *n2)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (multiply_fractions(n1->num, n1->den, n2->num, n2->den,
+							   n1->is_reduced && n2->is_reduced));
+}
+
+/**
+ * rational_division - divide two rationals.
+ * @n1: the numerator
+ * @n2: the denominator
+ *
+ * Description: a/b / (c/d) = a/b * d/c, see multiply_fractions().
+ *
+ * Return: the result, NULL on failure or division by zero
+ */
+infiX_rational *rational_division(const infiX_rational *n1, const infiX_rational *n2)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	if (n2->num->len < 2 && !n2->num->array[0])
+	{
+		fprintf(stderr, "Division by zero error.\n");
+		return (NULL);
+	}
+
+	/*c's sign ends up on the denominator, wrap_fraction() moves it back.*/
+	return (multiply_fractions(n1->num, n1->den, n2->den, n2->num,
+							   n1->is_reduced && n2->is_reduced));
+}
@@ -0,0 +1,118 @@
+#include "infiX.h"
+
+/**
+ * infiX_residue - reduce a number modulo a 32 bit modulus.
+ * @n: the number
+ * @modulus: the modulus, not zero
+ * @residue: where to store n mod modulus, in [0, modulus)
+ *
+ * Description: one pass over n's limbs without allocating, use this instead
+ * of infiX_modulus() for divisibility tests. For a negative n the residue is
+ * the magnitude of infiX_modulus()'s result.
+ *
+ * Return: 0 on success, -1 on failure (nothing is stored)
+ */
+int infiX_residue(const u4b_array *n, uint32_t modulus, uint32_t *residue)
+{
+	uint32_t rem = 0;
+
+	if (!n || !modulus || !residue)
+		return (-1);
+
+	if (n->len && n->array)
+		rem = limbs_divrem_1_preinv(NULL, n->array, n->len, modulus,
+									limbs_invert_limb(modulus));
+
+	*residue = n->is_negative && rem ? modulus - rem : rem;
+	return (0);
+}
+
+/**
+ * residue_table_new - prepare a table of moduli for infiX_residues().
+ * @moduli: the moduli, none of them zero
+ * @count: number of moduli
+ *
+ * Return: the table (free with free_residue_table()), NULL on failure
+ */
+residue_table *residue_table_new(const uint32_t *moduli, size_t count)
+{
+	residue_table *table = NULL;
+	size_t m = 0;
+
+	if (!moduli || !count)
+		return (NULL);
+
+	for (m = 0; m < count; m++)
+	{
+		if (!moduli[m])
+			return (NULL);
+	}
+
+	table = xcalloc(1, sizeof(*table));
+	if (!table)
+		return (NULL);
+
+	table->moduli = xcalloc(count, sizeof(*table->moduli));
+	table->inverses = xcalloc(count, sizeof(*table->inverses));
+	if (!table->moduli || !table->inverses)
+		return (free_residue_table(table));
+
+	table->count = count;
+	for (m = 0; m < count; m++)
+	{
+		table->moduli[m] = moduli[m];
+		table->inverses[m] = limbs_invert_limb(moduli[m]);
+	}
+
+	return (table);
+}
+
+/**
+ * free_residue_table - free a table from residue_table_new().
+ * @table: the table, may be NULL
+ *
+ * Return: NULL always.
+ */
+void *free_residue_table(residue_table *table)
+{
+	if (!table)
+		return (NULL);
+
+	table->moduli = free_n_null(table->moduli);
+	table->inverses = free_n_null(table->inverses);
+	return (free_n_null(table));
+}
+
+/**
+ * infiX_residues - reduce a number by every modulus of a table.
+ * @n: the number
+ * @table: the moduli, from residue_table_new()
+ * @residues: where to store the table->count residues, see infiX_residue()
+ *
+ * Description: all the residues come from a single sweep over n's limbs.
+ *
+ * Return: 0 on success, -1 on failure (nothing is stored)
+ */
+int infiX_residues(const u4b_array *n, const residue_table *table, uint32_t *residues)
+{
+	size_t m = 0;
+
+	if (!n || !table || !residues)
+		return (-1);
+
+	if (!n->len || !n->array)
+	{
+		memset(residues, 0, sizeof(*residues) * table->count);
+		return (0);
+	}
+
+	limbs_mod_1s(residues, n->array, n->len, table->moduli, table->inverses,
+				 table->count);
+	for (m = 0; n->is_negative && m < table->count; m++)
+	{
+		if (residues[m])
+			residues[m] = table->moduli[m] - residues[m];
+	}
+
+	return (0);
+}
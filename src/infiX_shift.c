@@ -0,0 +1,144 @@
+#include "infiX.h"
+
+/*Powers of ten that fit in a limb.*/
+static const uint32_t pow10_u4b[MAX_DIGITS_u4b] = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+/**
+ * infiX_shift_left - multiply a number by a power of ten.
+ * @n: the number
+ * @digits: the power of ten
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+u4b_array *infiX_shift_left(const u4b_array *n, size_t digits)
+{
+	return (infiX_shift_left_into(NULL, n, digits));
+}
+
+/**
+ * infiX_shift_left_into - multiply a number by a power of ten into an array.
+ * @dest: array to store the result in, NULL to allocate a new one
+ * @n: the number
+ * @digits: the power of ten
+ *
+ * Description: whole limbs are moved and the remaining digits % 9 are
+ * shifted in with one limbs_mul_1() pass, so this is O(n). dest may be the
+ * same struct as n to shift in place.
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+u4b_array *infiX_shift_left_into(u4b_array *dest, const u4b_array *n, size_t digits)
+{
+	u4b_array *result = dest, view = {0};
+	size_t limbs = digits / MAX_DIGITS_u4b, result_len = 0;
+	char is_negative = 0;
+
+	if (!n)
+		return (NULL);
+
+	view = slice_u4b_array(n, 0, n->len);
+	trim_u4b_array(&view);
+	is_negative = view.is_negative;
+	if (view.len > 1 || (view.len && view.array[0]))
+		result_len = view.len + limbs + 1;
+	else
+		result_len = view.len;
+
+	if (!result)
+		result = alloc_u4b_array(0);
+
+	/*Resized before n is viewed again, in case dest is n.*/
+	if (!result || resize_u4b_array(result, result_len))
+		return (result == dest ? NULL : free_u4b_array(result));
+
+	view = slice_u4b_array(n, 0, view.len);
+	if (result_len > view.len)
+	{
+		limbs_lshift(result->array, view.array, view.len, limbs);
+		result->array[view.len + limbs] =
+			limbs_mul_1(&result->array[limbs], &result->array[limbs], view.len,
+						pow10_u4b[digits % MAX_DIGITS_u4b]);
+	}
+	else if (result_len)
+		result->array[0] = 0;
+
+	result->is_negative = is_negative;
+	trim_u4b_array(result);
+	ASSERT_NORMALIZED(result);
+	return (result);
+}
+
+/**
+ * infiX_shift_right - divide a number by a power of ten.
+ * @n: the number
+ * @digits: the power of ten
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+u4b_array *infiX_shift_right(const u4b_array *n, size_t digits)
+{
+	return (infiX_shift_right_into(NULL, n, digits));
+}
+
+/**
+ * infiX_shift_right_into - divide a number by a power of ten into an array.
+ * @dest: array to store the result in, NULL to allocate a new one
+ * @n: the number
+ * @digits: the power of ten
+ *
+ * Description: the quotient is floored like infiX_division()'s, -15 >> 1
+ * digit is -2. Whole limbs are dropped and the remaining digits % 9 are
+ * shifted out with one limbs_divrem_1() pass, so this is O(n). dest may be
+ * the same struct as n to shift in place.
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+u4b_array *infiX_shift_right_into(u4b_array *dest, const u4b_array *n, size_t digits)
+{
+	uint32_t a[] = {1};
+	u4b_array *result = dest, view = {0};
+	size_t limbs = digits / MAX_DIGITS_u4b, result_len = 1, i = 0;
+	char is_negative = 0, dropped = 0;
+
+	if (!n)
+		return (NULL);
+
+	if (!result)
+		result = alloc_u4b_array(0);
+
+	/*Resized before n is viewed, in case dest is n.*/
+	if (!result || resize_u4b_array(result, n->len + 1))
+		return (result == dest ? NULL : free_u4b_array(result));
+
+	view = slice_u4b_array(n, 0, n->len);
+	trim_u4b_array(&view);
+	is_negative = view.is_negative;
+	for (i = 0; i < limbs && i < view.len; i++)
+		dropped |= (view.array[i] != 0);
+
+	if (view.len > limbs)
+	{
+		result_len = view.len - limbs;
+		limbs_rshift(result->array, view.array, view.len, limbs);
+		dropped |= (limbs_divrem_1(result->array, result->array, result_len,
+								   pow10_u4b[digits % MAX_DIGITS_u4b]) != 0);
+	}
+
+	if (resize_u4b_array(result, result_len + 1))
+		return (result == dest ? NULL : free_u4b_array(result));
+
+	result->array[result_len] = 0;
+	if (view.len <= limbs)
+		result->array[0] = 0;
+
+	/*-15 // 10 = -((15 // 10) + 1)*/
+	if (is_negative && dropped)
+		result->array[result_len] = limbs_add(result->array, result->array,
+											  result_len, a, 1);
+
+	result->is_negative = is_negative;
+	trim_u4b_array(result);
+	ASSERT_NORMALIZED(result);
+	return (result);
+}
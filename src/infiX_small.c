@@ -0,0 +1,183 @@
+#include "infiX.h"
+
+/**
+ * small_from_str - parse a number string that fits in a machine word.
+ * @num_str: a string of numbers, as accepted by parse_numstr()
+ * @value: where to store the number
+ *
+ * Description: any number from INT64_MIN to INT64_MAX is accepted, any +, -,
+ * x, / or % of two of them fits in an int128_t.
+ *
+ * Return: 0 on success, -1 if the string is not a small number (the caller
+ * should fall back to the u4b_array path, which also reports bad input).
+ */
+int small_from_str(const char *num_str, int64_t *value)
+{
+	size_t i = 0;
+	uint64_t n = 0, limit = INT64_MAX;
+	char is_negative = 0;
+
+	if (!num_str || !num_str[0] || !value)
+		return (-1);
+
+	if (num_str[0] == '-')
+	{
+		is_negative = 1;
+		limit = (uint64_t)INT64_MAX + 1;
+		i++;
+	}
+
+	if (misplaced_underscore(&num_str[i], strlen(&num_str[i])))
+		return (-1);
+
+	for (; num_str[i]; i++)
+	{
+		if (num_str[i] >= '0' && num_str[i] <= '9')
+		{
+			if (n > (limit - (uint64_t)(num_str[i] - '0')) / 10)
+				return (-1);
+
+			n = n * 10 + (uint64_t)(num_str[i] - '0');
+		}
+		else if (num_str[i] != ',' && num_str[i] != ' ' && num_str[i] != '_')
+			return (-1);
+	}
+
+	/*-(n - 1) - 1 so that INT64_MIN's magnitude never has to fit.*/
+	*value = is_negative && n ? -(int64_t)(n - 1) - 1 : (int64_t)n;
+	return (0);
+}
+
+#ifdef INFIX_HAS_INT128
+
+static char *int128_to_str(int128_t n);
+
+/**
+ * int128_to_str - convert an int128_t to a string of numbers.
+ * @n: the number, at most 2^126 (the product of two INT64_MIN) in magnitude
+ *
+ * Description: n is split into 18 digit chunks, so at most three 128 bit
+ * divisions are done and the digits come from 64 bit arithmetic.
+ *
+ * Return: a pointer to a string of numbers, NULL on failure
+ */
+char *int128_to_str(int128_t n)
+{
+	/*2^126 has 38 digits, +1 for a sign and +1 for the null byte.*/
+	char digits[40] = {0}, *num_str = NULL;
+	size_t i = sizeof(digits) - 1, d = 0;
+	const int64_t chunk_max = 1000000000000000000;
+	const size_t chunk_digits = 18;
+	int128_t magnitude = n < 0 ? -n : n;
+	uint64_t chunk = 0;
+
+	do {
+		chunk = magnitude % chunk_max;
+		magnitude /= chunk_max;
+		/*Chunks below the most significant one keep their leading zeros.*/
+		for (d = 0; d < chunk_digits && (chunk || magnitude || !d); d++)
+		{
+			digits[--i] = '0' + chunk % 10;
+			chunk /= 10;
+		}
+	} while (magnitude);
+
+	if (n < 0)
+		digits[--i] = '-';
+
+	num_str = xmalloc(sizeof(digits) - i);
+	if (num_str)
+		memmove(num_str, &digits[i], sizeof(digits) - i);
+
+	return (num_str);
+}
+
+/**
+ * infiX_small - calculate with numbers that fit in a machine word.
+ * @num1: first number
+ * @op_symbol: operator
+ * @num2: second number
+ *
+ * Description: a fast path for infiX_manager(), no u4b_arrays are allocated.
+ * Division and modulus follow infiX_divmod(). Division by zero is left to
+ * the u4b_array path so that it is reported the same way. '&', '|' and '^'
+ * act on int64_t's two's complement, the same as infiX_and() and the rest.
+ *
+ * Return: pointer to the answer string, NULL if the fast path does not apply
+ * or on failure.
+ */
+char *infiX_small(const char *num1, const char *op_symbol, const char *num2)
+{
+	int64_t a = 0, b = 0;
+	int128_t result = 0, a_abs = 0, b_abs = 0, mod = 0;
+
+	if (!op_symbol || !op_symbol[0] || op_symbol[1] ||
+		small_from_str(num1, &a) || small_from_str(num2, &b))
+		return (NULL);
+
+	a_abs = a < 0 ? -(int128_t)a : a;
+	b_abs = b < 0 ? -(int128_t)b : b;
+	switch (op_symbol[0])
+	{
+	case '+':
+		result = (int128_t)a + b;
+		break;
+	case '-':
+		result = (int128_t)a - b;
+		break;
+	case 'x':
+		result = (int128_t)a * b;
+		break;
+	case '/':
+	case '%':
+		if (!b)
+			return (NULL);
+
+		mod = a_abs % b_abs;
+		if (op_symbol[0] == '/')
+			result = a_abs / b_abs;
+		else
+			result = mod;
+
+		/*-8 // 5 = -((8 // 5) + 1), -8 % 5 = -(5 - (8 % 5))*/
+		if ((a < 0) != (b < 0) && op_symbol[0] == '/')
+			result = -(result + (mod ? 1 : 0));
+		else if ((a < 0) != (b < 0) && mod)
+			result = -(b_abs - mod);
+
+		break;
+	case '&':
+		result = a & b;
+		break;
+	case '|':
+		result = a | b;
+		break;
+	case '^':
+		result = a ^ b;
+		break;
+	default:
+		return (NULL);
+	}
+
+	return (int128_to_str(result));
+}
+
+#else /*!INFIX_HAS_INT128*/
+
+/**
+ * infiX_small - fast path stub for compilers without a 128 bit integer.
+ * @num1: unused
+ * @op_symbol: unused
+ * @num2: unused
+ *
+ * Return: NULL always, the u4b_array path is used instead.
+ */
+char *infiX_small(const char *num1, const char *op_symbol, const char *num2)
+{
+	(void)num1;
+	(void)op_symbol;
+	(void)num2;
+	return (NULL);
+}
+
+#endif /*INFIX_HAS_INT128*/
@@ -1,7 +1,7 @@
 #include "infiX.h"
 
-static u4b_array *subtract_negatives(u4b_array *n1, u4b_array *n2)
-	ATTR_NONNULL;
+static u4b_array *subtract_negatives(u4b_array *dest, u4b_array *n1, u4b_array *n2)
+	ATTR_NONNULL_IDX(2, 3);
 
 /**
  * infiX_subtraction - subtract large numbers stored in arrays
@@ -10,84 +10,99 @@ static u4b_array *subtract_negatives(u4b_array *n1, u4b_array *n2)
  *
  * Return: pointer to the diff, NULL on failure
  */
-u4b_array *infiX_subtraction(u4b_array *n1, u4b_array *n2)
+u4b_array *infiX_subtraction(const u4b_array *n1, const u4b_array *n2)
 {
-	size_t n1_i = 0, n2_i = 0, diff_i = 0, result_len = 0;
+	return (infiX_subtraction_into(NULL, n1, n2));
+}
+
+/**
+ * infiX_subtraction_into - subtract large numbers into a given array
+ * @dest: array to store the diff in, NULL to allocate a new one
+ * @n1: number to be subtracted
+ * @n2: number to subtract
+ *
+ * Description: dest's buffer is reused if it has enough capacity, it may be
+ * the same struct as n1 or n2 for in-place accumulation. n1 and n2 are only
+ * read through views, so they are never modified (unless one is dest).
+ *
+ * Return: pointer to the diff, NULL on failure
+ */
+u4b_array *infiX_subtraction_into(u4b_array *dest, const u4b_array *n1, const u4b_array *n2)
+{
+	size_t result_len = 0;
 	ssize_t n1_is_bigger = 0;
-	int64_t byt_diff = 0;
-	u4b_array *diff = NULL;
+	u4b_array *diff = dest, a = {0}, b = {0}, tmp = {0};
 
 	if (!n1 || !n2)
 		return (NULL);
 
-	trim_u4b_array(n1);
-	trim_u4b_array(n2);
-	if (n1->is_negative || n2->is_negative)
-		return (subtract_negatives(n1, n2));
+	/*Grow dest before viewing the inputs, in case it is one of them.*/
+	if (dest && reserve_u4b_array(dest, (n1->len > n2->len) ? n1->len : n2->len))
+		return (NULL);
+
+	a = slice_u4b_array(n1, 0, n1->len);
+	b = slice_u4b_array(n2, 0, n2->len);
+	trim_u4b_array(&a);
+	trim_u4b_array(&b);
+	if (a.is_negative || b.is_negative)
+		return (subtract_negatives(dest, &a, &b));
 
 	/*result_len = max(n1->len, n2->len)*/
-	result_len = (n1->len > n2->len) ? n1->len : n2->len;
-	/*If both arrays are of the same length then;*/
-	/*result_len = n1->len - */
-	/*(length of continuous matches in n1 and n2 from msd down to lsd).*/
-	if (n1->len == n2->len)
-		while (result_len > 2 && n1->array[result_len - 1] == n2->array[result_len - 1])
-			result_len--;
-
-	diff = alloc_u4b_array(result_len);
-	if (!diff)
-		return (NULL);
+	result_len = (a.len > b.len) ? a.len : b.len;
+	/*The views are normalized, so the longer one is the bigger one.*/
+	n1_is_bigger = (ssize_t)a.len - b.len;
+	if (!n1_is_bigger)
+	{
+		/*Matching limbs from the msd down cancel out, skip them.*/
+		while (a.len && a.array[a.len - 1] == b.array[a.len - 1])
+			a.len--;
 
-	n1_is_bigger = cmp_u4barray(n1, n2);
-	if (n1_is_bigger <= 0)
-		diff->is_negative = 1;
+		b.len = a.len;
+		if (a.len)
+			n1_is_bigger = (a.array[a.len - 1] > b.array[a.len - 1]) ? 1 : -1;
+		else if (result_len)
+			result_len = 1;
+	}
 
-	while ((n1_i < n1->len || n2_i < n2->len) && diff_i < diff->len)
+	/*Always subtract the smaller magnitude from the bigger one.*/
+	if (n1_is_bigger < 0)
 	{
-		if (n1_is_bigger > 0) /*then; n1 - n2*/
-		{
-			if (n2_i < n2->len)
-				byt_diff += (int64_t)n1->array[n1_i] - n2->array[n2_i];
-			else
-				byt_diff += n1->array[n1_i];
-		}
-		else /*n2 - n1*/
-		{
-			if (n1_i < n1->len)
-				byt_diff += (int64_t)n2->array[n2_i] - n1->array[n1_i];
-			else
-				byt_diff += n2->array[n2_i];
-		}
-
-		if (byt_diff < 0) /*borrow 1 from next.*/
-		{
-			byt_diff += MAX_VAL_u4b;
-			diff->array[diff_i] = byt_diff % MAX_VAL_u4b;
-			byt_diff = -1;
-		}
-		else
-		{
-			diff->array[diff_i] = byt_diff % MAX_VAL_u4b;
-			byt_diff = 0;
-		}
-
-		++n1_i;
-		++n2_i;
-		++diff_i;
+		tmp = a;
+		a = b;
+		b = tmp;
 	}
 
+	if (a.len)
+		result_len = a.len;
+
+	if (!diff)
+		diff = alloc_u4b_array(result_len);
+	else if (resize_u4b_array(diff, result_len))
+		return (NULL);
+
+	if (!diff)
+		return (NULL);
+
+	diff->is_negative = (n1_is_bigger < 0);
+	if (a.len)
+		limbs_sub(diff->array, a.array, a.len, b.array, b.len);
+	else if (result_len)
+		diff->array[0] = 0;
+
 	trim_u4b_array(diff);
+	ASSERT_NORMALIZED(diff);
 	return (diff);
 }
 
 /**
  * subtract_negatives - subtraction of only signed numbers (negative numbers)
- * @n1: number to be subtracted
- * @n2: number to subtract
+ * @dest: array to store the diff in, NULL to allocate a new one
+ * @n1: view of the number to be subtracted, its sign is changed
+ * @n2: view of the number to subtract, its sign is changed
  *
- * Return: 1 if action taken (error or processed results), 0 if no action taken
+ * Return: pointer to the diff, NULL on failure
  */
-u4b_array *subtract_negatives(u4b_array *n1, u4b_array *n2)
+u4b_array *subtract_negatives(u4b_array *dest, u4b_array *n1, u4b_array *n2)
 {
 	u4b_array *result = NULL;
 
@@ -96,16 +111,13 @@ u4b_array *subtract_negatives(u4b_array *n1, u4b_array *n2)
 		/*-8 - -5 = -8 + 5 = 5-8*/
 		n1->is_negative = 0;
 		n2->is_negative = 0;
-		result = infiX_subtraction(n2, n1);
-		n1->is_negative = 1;
-		n2->is_negative = 1;
+		result = infiX_subtraction_into(dest, n2, n1);
 	}
 	else if (n1->is_negative)
 	{
 		/*-8 - 5 = -(8+5)*/
 		n1->is_negative = 0;
-		result = infiX_addition(n1, n2);
-		n1->is_negative = 1;
+		result = infiX_addition_into(dest, n1, n2);
 		if (result)
 			result->is_negative = 1;
 	}
@@ -113,8 +125,7 @@ u4b_array *subtract_negatives(u4b_array *n1, u4b_array *n2)
 	{
 		/*8 - -5 = 8+5*/
 		n2->is_negative = 0;
-		result = infiX_addition(n1, n2);
-		n2->is_negative = 1;
+		result = infiX_addition_into(dest, n1, n2);
 	}
 
 	return (result);
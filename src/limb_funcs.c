@@ -0,0 +1,995 @@
+#include "infiX.h"
+
+static uint64_t div_preinv(uint64_t num, uint32_t d, uint64_t inverse,
+						   uint64_t *rem) ATTR_NONNULL;
+static uint32_t gcd_limb(uint32_t a, uint32_t b);
+static void mul_basecase(uint32_t *rp, const uint32_t *up, size_t un,
+						 const uint32_t *vp, size_t vn, int accumulate)
+	ATTR_NONNULL;
+static void add_chunk_product(uint32_t *rp, const uint32_t *pp, size_t pn,
+							  size_t len) ATTR_NONNULL;
+static uint32_t invert_limb_mod(uint32_t d);
+static size_t mul_n_cost(size_t n);
+
+/**
+ * limbs_add_n - add two limb vectors of the same length.
+ * @rp: where to store the sum, may be the same as up or vp
+ * @up: the first vector
+ * @vp: the second vector
+ * @n: number of limbs in each vector
+ *
+ * Return: the carry out of the top limb (0 or 1).
+ */
+uint32_t limbs_add_n(uint32_t *rp, const uint32_t *up, const uint32_t *vp, size_t n)
+{
+	uint32_t carry = 0, sum = 0;
+	size_t i = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		sum = up[i] + vp[i] + carry;
+		carry = (sum >= MAX_VAL_u4b);
+		rp[i] = carry ? sum - MAX_VAL_u4b : sum;
+	}
+
+	return (carry);
+}
+
+/**
+ * limbs_add - add two limb vectors of different lengths.
+ * @rp: where to store the un limbs of the sum, may be the same as up or vp
+ * @up: the longer vector
+ * @un: number of limbs in up
+ * @vp: the shorter vector
+ * @vn: number of limbs in vp, at most un
+ *
+ * Return: the carry out of the top limb (0 or 1).
+ */
+uint32_t limbs_add(uint32_t *rp, const uint32_t *up, size_t un,
+				   const uint32_t *vp, size_t vn)
+{
+	uint32_t carry = limbs_add_n(rp, up, vp, vn);
+	size_t i = vn;
+
+	for (; i < un; i++)
+	{
+		rp[i] = up[i] + carry;
+		carry = (rp[i] == MAX_VAL_u4b);
+		if (carry)
+			rp[i] = 0;
+	}
+
+	return (carry);
+}
+
+/**
+ * limbs_sub_n - subtract two limb vectors of the same length.
+ * @rp: where to store up - vp, may be the same as up or vp
+ * @up: vector to subtract from
+ * @vp: vector to subtract
+ * @n: number of limbs in each vector
+ *
+ * Return: the borrow out of the top limb (0 or 1).
+ */
+uint32_t limbs_sub_n(uint32_t *rp, const uint32_t *up, const uint32_t *vp, size_t n)
+{
+	uint32_t borrow = 0, sub = 0;
+	size_t i = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		sub = vp[i] + borrow;
+		borrow = (up[i] < sub);
+		rp[i] = borrow ? up[i] + MAX_VAL_u4b - sub : up[i] - sub;
+	}
+
+	return (borrow);
+}
+
+/**
+ * limbs_sub - subtract a shorter limb vector from a longer one.
+ * @rp: where to store the un limbs of up - vp, may be the same as up or vp
+ * @up: vector to subtract from
+ * @un: number of limbs in up
+ * @vp: vector to subtract
+ * @vn: number of limbs in vp, at most un
+ *
+ * Return: the borrow out of the top limb (0 or 1).
+ */
+uint32_t limbs_sub(uint32_t *rp, const uint32_t *up, size_t un,
+				   const uint32_t *vp, size_t vn)
+{
+	uint32_t borrow = limbs_sub_n(rp, up, vp, vn);
+	size_t i = vn;
+
+	for (; i < un; i++)
+	{
+		if (borrow && !up[i])
+			rp[i] = MAX_VAL_u4b - 1;
+		else
+		{
+			rp[i] = up[i] - borrow;
+			borrow = 0;
+		}
+	}
+
+	return (borrow);
+}
+
+/**
+ * limbs_mul_1 - multiply a limb vector by a single limb.
+ * @rp: where to store the n low limbs of the product, may be the same as up
+ * @up: the vector
+ * @n: number of limbs in up
+ * @v: the limb to multiply by, less than MAX_VAL_u4b
+ *
+ * Return: the top limb of the product.
+ */
+uint32_t limbs_mul_1(uint32_t *rp, const uint32_t *up, size_t n, uint32_t v)
+{
+	uint64_t byt_mul = 0;
+	size_t i = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		byt_mul += (uint64_t)up[i] * v;
+		rp[i] = byt_mul % MAX_VAL_u4b;
+		byt_mul /= MAX_VAL_u4b;
+	}
+
+	return (byt_mul);
+}
+
+/**
+ * limbs_addmul_1 - add the product of a limb vector and a limb to a vector.
+ * @rp: the n limb vector to add to, must not overlap up
+ * @up: the vector to multiply
+ * @n: number of limbs in up
+ * @v: the limb to multiply by, less than MAX_VAL_u4b
+ *
+ * Return: the limb carried out of rp.
+ */
+uint32_t limbs_addmul_1(uint32_t *rp, const uint32_t *up, size_t n, uint32_t v)
+{
+	uint64_t byt_mul = 0;
+	size_t i = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		byt_mul += (uint64_t)up[i] * v + rp[i];
+		rp[i] = byt_mul % MAX_VAL_u4b;
+		byt_mul /= MAX_VAL_u4b;
+	}
+
+	return (byt_mul);
+}
+
+/**
+ * limbs_submul_1 - subtract the product of a limb vector and a limb.
+ * @rp: the n limb vector to subtract from, must not overlap up
+ * @up: the vector to multiply
+ * @n: number of limbs in up
+ * @v: the limb to multiply by, less than MAX_VAL_u4b
+ *
+ * Return: the limb borrowed from above rp.
+ */
+uint32_t limbs_submul_1(uint32_t *rp, const uint32_t *up, size_t n, uint32_t v)
+{
+	uint64_t byt_mul = 0;
+	uint32_t low = 0;
+	size_t i = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		byt_mul += (uint64_t)up[i] * v;
+		low = byt_mul % MAX_VAL_u4b;
+		byt_mul /= MAX_VAL_u4b;
+		if (rp[i] < low)
+		{
+			rp[i] += MAX_VAL_u4b - low;
+			byt_mul++;
+		}
+		else
+			rp[i] -= low;
+	}
+
+	return (byt_mul);
+}
+
+/**
+ * limbs_divrem_1 - divide a limb vector by a single limb.
+ * @qp: where to store the n limbs of the quotient, may be up or NULL
+ * @up: the numerator
+ * @n: number of limbs in up
+ * @v: the denominator, not zero and less than MAX_VAL_u4b
+ *
+ * Return: the remainder.
+ */
+uint32_t limbs_divrem_1(uint32_t *qp, const uint32_t *up, size_t n, uint32_t v)
+{
+	return (limbs_divrem_1_preinv(qp, up, n, v, limbs_invert_limb(v)));
+}
+
+/**
+ * limbs_lshift - multiply a limb vector by a power of MAX_VAL_u4b.
+ * @rp: where to store the n + shift limbs of the result, may overlap up
+ * @up: the vector
+ * @n: number of limbs in up
+ * @shift: number of limbs to shift by
+ */
+void limbs_lshift(uint32_t *rp, const uint32_t *up, size_t n, size_t shift)
+{
+	if (n)
+		memmove(&rp[shift], up, sizeof(*up) * n);
+
+	if (shift)
+		memset(rp, 0, sizeof(*rp) * shift);
+}
+
+/**
+ * limbs_rshift - divide a limb vector by a power of MAX_VAL_u4b.
+ * @rp: where to store the n - shift limbs of the result, may overlap up
+ * @up: the vector
+ * @n: number of limbs in up, more than shift
+ * @shift: number of limbs to shift by
+ */
+void limbs_rshift(uint32_t *rp, const uint32_t *up, size_t n, size_t shift)
+{
+	if (n > shift)
+		memmove(rp, &up[shift], sizeof(*up) * (n - shift));
+}
+
+/**
+ * limbs_cmp - compare two limb vectors of the same length.
+ * @up: the first vector
+ * @vp: the second vector
+ * @n: number of limbs in each vector
+ *
+ * Return: 1 if up > vp, -1 if up < vp, else 0.
+ */
+int limbs_cmp(const uint32_t *up, const uint32_t *vp, size_t n)
+{
+	while (n-- > 0)
+	{
+		if (up[n] != vp[n])
+			return (up[n] > vp[n] ? 1 : -1);
+	}
+
+	return (0);
+}
+
+/**
+ * mul_basecase - schoolbook multiplication of two limb vectors.
+ * @rp: where to add the product, the un limbs from rp[0] are added to and
+ * the vn limbs above them are overwritten
+ * @up: the first vector
+ * @un: number of limbs in up, at least 1
+ * @vp: the second vector
+ * @vn: number of limbs in vp, at least 1
+ * @accumulate: 0 if rp's first un limbs should be overwritten too
+ */
+void mul_basecase(uint32_t *rp, const uint32_t *up, size_t un,
+				  const uint32_t *vp, size_t vn, int accumulate)
+{
+	size_t i = 0;
+
+	/*One row per limb of vp, each added in one pass.*/
+	if (accumulate)
+		rp[un] = limbs_addmul_1(rp, up, un, vp[0]);
+	else
+		rp[un] = limbs_mul_1(rp, up, un, vp[0]);
+
+	for (i = 1; i < vn; i++)
+		rp[un + i] = limbs_addmul_1(&rp[i], up, un, vp[i]);
+}
+
+/**
+ * limbs_mul_itch - scratch space needed by limbs_mul().
+ * @un: number of limbs in the first vector
+ * @vn: number of limbs in the second vector
+ *
+ * Return: number of limbs of scratch space, 0 if the product is done by
+ * schoolbook.
+ */
+size_t limbs_mul_itch(size_t un, size_t vn)
+{
+	size_t itch = 0, rest = 0;
+
+	if (un < vn)
+	{
+		rest = un;
+		un = vn;
+		vn = rest;
+	}
+
+	if (vn < KARATSUBA_LIMBS)
+		return (0);
+
+	/*A chunk's product, then limbs_mul_n() or the short top chunk's limbs_mul().*/
+	itch = limbs_mul_n_itch(vn);
+	rest = limbs_mul_itch(vn, un % vn);
+	return (2 * vn + (itch > rest ? itch : rest));
+}
+
+/**
+ * add_chunk_product - add a chunk's product to the limbs below it.
+ * @rp: where the product goes, the low len limbs hold the previous chunks'
+ * top limbs and the rest are not written yet
+ * @pp: the product
+ * @pn: number of limbs in pp
+ * @len: number of limbs of pp that overlap the previous chunks, at most pn
+ */
+void add_chunk_product(uint32_t *rp, const uint32_t *pp, size_t pn, size_t len)
+{
+	uint32_t carry = limbs_add_n(rp, rp, pp, len);
+
+	/*The whole product fits, so the carry stops inside pp's top limbs.*/
+	if (pn > len)
+		limbs_add(&rp[len], &pp[len], pn - len, &carry, 1);
+}
+
+/**
+ * limbs_mul - multiply two limb vectors.
+ * @rp: where to store the un + vn limbs of the product, must not overlap
+ * up, vp or scratch
+ * @up: the first vector
+ * @un: number of limbs in up, at least 1
+ * @vp: the second vector
+ * @vn: number of limbs in vp, at least 1
+ * @scratch: limbs_mul_itch(un, vn) limbs of scratch space, may be NULL when
+ * that is 0
+ *
+ * Description: the order of the operands does not matter. The longer one is
+ * cut into chunks and each chunk's product is added to the result at its
+ * offset, so every pass only touches a window of about 2 chunks. When the
+ * shorter vector has at least KARATSUBA_LIMBS limbs the chunks are its
+ * length and each is multiplied by limbs_mul_n(), the short top chunk by
+ * limbs_mul() again. Otherwise the chunks are at least MUL_CHUNK_LIMBS long
+ * and multiplied by schoolbook.
+ */
+void limbs_mul(uint32_t *rp, const uint32_t *up, size_t un,
+			   const uint32_t *vp, size_t vn, uint32_t *scratch)
+{
+	const uint32_t *tmp = NULL;
+	size_t chunk = 0, offset = 0, len = 0;
+
+	if (un < vn)
+	{
+		tmp = up;
+		up = vp;
+		vp = tmp;
+		len = un;
+		un = vn;
+		vn = len;
+	}
+
+	if (vn >= KARATSUBA_LIMBS)
+	{
+		limbs_mul_n(rp, up, vp, vn, &scratch[2 * vn]);
+		for (offset = vn; offset + vn <= un; offset += vn)
+		{
+			limbs_mul_n(scratch, &up[offset], vp, vn, &scratch[2 * vn]);
+			add_chunk_product(&rp[offset], scratch, 2 * vn, vn);
+		}
+
+		len = un - offset;
+		if (len)
+		{
+			limbs_mul(scratch, vp, vn, &up[offset], len, &scratch[2 * vn]);
+			add_chunk_product(&rp[offset], scratch, vn + len, vn);
+		}
+
+		return;
+	}
+
+	chunk = vn < MUL_CHUNK_LIMBS ? MUL_CHUNK_LIMBS : vn;
+	/*The short last chunk goes first, the rest start on a full chunk's top.*/
+	len = un % chunk ? un % chunk : chunk;
+	mul_basecase(rp, up, len, vp, vn, 0);
+	for (offset = len; offset < un; offset += chunk)
+	{
+		/*Only the previous chunk's top vn limbs are there to add to.*/
+		memset(&rp[offset + vn], 0, sizeof(*rp) * (chunk - vn));
+		mul_basecase(&rp[offset], &up[offset], chunk, vp, vn, 1);
+	}
+}
+
+/**
+ * mul_n_cost - estimate the work of limbs_mul_n().
+ * @n: number of limbs in each vector
+ *
+ * Description: three half size products and about 4 * n limb additions and
+ * subtractions at every Karatsuba level, schoolbook below KARATSUBA_LIMBS.
+ *
+ * Return: the cost in limb products.
+ */
+size_t mul_n_cost(size_t n)
+{
+	size_t lo = (n + 1) / 2;
+
+	if (n < KARATSUBA_LIMBS)
+		return (n * n);
+
+	return (mul_n_cost(lo + 1) + mul_n_cost(lo) + mul_n_cost(n - lo) + 4 * n);
+}
+
+/**
+ * limbs_mul_cost - estimate the work of limbs_mul().
+ * @un: number of limbs in the first vector
+ * @vn: number of limbs in the second vector
+ *
+ * Description: the chunks are costed the way limbs_mul() multiplies them, by
+ * limbs_mul_n() or by schoolbook.
+ *
+ * Return: the cost in limb products.
+ */
+size_t limbs_mul_cost(size_t un, size_t vn)
+{
+	size_t rest = 0;
+
+	if (un < vn)
+	{
+		rest = un;
+		un = vn;
+		vn = rest;
+	}
+
+	if (vn < KARATSUBA_LIMBS)
+		return (un * vn);
+
+	rest = un % vn;
+	return ((un / vn) * mul_n_cost(vn) + (rest ? limbs_mul_cost(vn, rest) : 0));
+}
+
+/**
+ * limbs_mul_n_itch - scratch space needed by limbs_mul_n().
+ * @n: number of limbs in each vector
+ *
+ * Return: number of limbs of scratch space.
+ */
+size_t limbs_mul_n_itch(size_t n)
+{
+	size_t itch = 0;
+
+	/*Two sums of lo + 1 limbs and their product at every level.*/
+	for (; n >= KARATSUBA_LIMBS; n = (n + 1) / 2 + 1)
+		itch += 4 * ((n + 1) / 2 + 1);
+
+	return (itch);
+}
+
+/**
+ * limbs_mul_n - multiply two limb vectors of the same length.
+ * @rp: where to store the 2 * n limbs of the product, must not overlap up,
+ * vp or scratch
+ * @up: the first vector
+ * @vp: the second vector
+ * @n: number of limbs in each vector, at least 1
+ * @scratch: limbs_mul_n_itch(n) limbs of scratch space
+ *
+ * Description: Karatsuba's method, with a = a1 * B^lo + a0 and
+ * b = b1 * B^lo + b0 the middle limbs a0 * b1 + a1 * b0 are
+ * (a0 + a1) * (b0 + b1) - a0 * b0 - a1 * b1, so 3 half size products are
+ * done instead of 4. Vectors shorter than KARATSUBA_LIMBS are multiplied by
+ * schoolbook.
+ */
+void limbs_mul_n(uint32_t *rp, const uint32_t *up, const uint32_t *vp,
+				 size_t n, uint32_t *scratch)
+{
+	size_t lo = (n + 1) / 2, hi = n - lo;
+	uint32_t *sa = scratch, *sb = &scratch[lo + 1], *mid = &scratch[2 * lo + 2];
+
+	if (n < KARATSUBA_LIMBS)
+	{
+		mul_basecase(rp, up, n, vp, n, 0);
+		return;
+	}
+
+	sa[lo] = limbs_add(sa, up, lo, &up[lo], hi);
+	sb[lo] = limbs_add(sb, vp, lo, &vp[lo], hi);
+	limbs_mul_n(mid, sa, sb, lo + 1, &scratch[4 * lo + 4]);
+	limbs_mul_n(rp, up, vp, lo, &scratch[4 * lo + 4]);
+	limbs_mul_n(&rp[2 * lo], &up[lo], &vp[lo], hi, &scratch[4 * lo + 4]);
+	limbs_sub(mid, mid, 2 * lo + 2, rp, 2 * lo);
+	limbs_sub(mid, mid, 2 * lo + 2, &rp[2 * lo], 2 * hi);
+	/*a0 * b1 + a1 * b0 < 2 * B^(lo + hi), its higher limbs are zero.*/
+	limbs_add(&rp[lo], &rp[lo], lo + 2 * hi, mid, lo + hi + 1);
+}
+
+/**
+ * limbs_runs - find the runs of nonzero limbs in a limb vector.
+ * @runs: where to store the start and end (exclusive) of each run, NULL to
+ * only count them
+ * @up: the vector
+ * @un: number of limbs in up
+ * @nonzero: where to store the number of nonzero limbs, may be NULL
+ *
+ * Return: number of runs.
+ */
+size_t limbs_runs(size_t *runs, const uint32_t *up, size_t un, size_t *nonzero)
+{
+	size_t i = 0, count = 0, limbs = 0;
+
+	while (i < un)
+	{
+		if (!up[i])
+		{
+			i++;
+			continue;
+		}
+
+		if (runs)
+			runs[count * 2] = i;
+
+		for (; i < un && up[i]; i++)
+			limbs++;
+
+		if (runs)
+			runs[count * 2 + 1] = i;
+
+		count++;
+	}
+
+	if (nonzero)
+		*nonzero = limbs;
+
+	return (count);
+}
+
+/**
+ * limbs_mul_sparse - multiply two limb vectors that are mostly zero limbs.
+ * @rp: where to store the un + vn limbs of the product, must not overlap
+ * up or vp
+ * @up: the first vector
+ * @un: number of limbs in up, at least 1
+ * @runs: the nruns runs of nonzero limbs in up, from limbs_runs()
+ * @nruns: number of runs
+ * @vp: the second vector
+ * @vn: number of limbs in vp, at least 1
+ *
+ * Description: zero limbs of vp are skipped and every other limb of vp is
+ * multiplied with up's runs only, so the work is proportional to the number
+ * of nonzero limbs in up times those in vp.
+ */
+void limbs_mul_sparse(uint32_t *rp, const uint32_t *up, size_t un,
+					  const size_t *runs, size_t nruns,
+					  const uint32_t *vp, size_t vn)
+{
+	uint64_t sum = 0;
+	uint32_t carry = 0;
+	size_t i = 0, r = 0, k = 0;
+
+	memset(rp, 0, sizeof(*rp) * (un + vn));
+	for (i = 0; i < vn; i++)
+	{
+		if (!vp[i])
+			continue;
+
+		for (r = 0; r < nruns; r++)
+		{
+			carry = limbs_addmul_1(&rp[i + runs[r * 2]], &up[runs[r * 2]],
+								   runs[r * 2 + 1] - runs[r * 2], vp[i]);
+			/*The carry can run into limbs other runs have written.*/
+			for (k = i + runs[r * 2 + 1]; carry; k++)
+			{
+				sum = (uint64_t)rp[k] + carry;
+				carry = (sum >= MAX_VAL_u4b);
+				rp[k] = carry ? sum - MAX_VAL_u4b : sum;
+			}
+		}
+	}
+}
+
+/**
+ * limbs_mul_sparse_wins - tell whether limbs_mul_sparse() is worth using.
+ * @un: number of limbs in the first vector
+ * @u_nonzero: number of nonzero limbs in it
+ * @u_runs: number of runs of nonzero limbs in it, see limbs_runs()
+ * @vn: number of limbs in the second vector
+ * @v_nonzero: number of nonzero limbs in it
+ *
+ * Description: every nonzero limb of the second vector is multiplied with
+ * the first's nonzero limbs, plus SPARSE_RUN_COST for each of its runs. That
+ * has to be at most 1 in SPARSE_MUL_RATIO of limbs_mul_cost(), which is well
+ * below un * vn once Karatsuba is used. At 4000 limbs only operands with
+ * fewer than about 1 in 7 nonzero limbs, spread at random, are left sparse.
+ *
+ * Return: 1 if limbs_mul_sparse() should be used, 0 for limbs_mul().
+ */
+int limbs_mul_sparse_wins(size_t un, size_t u_nonzero, size_t u_runs,
+						  size_t vn, size_t v_nonzero)
+{
+	size_t cost = v_nonzero * (u_nonzero + SPARSE_RUN_COST * u_runs);
+
+	return (cost * SPARSE_MUL_RATIO <= limbs_mul_cost(un, vn));
+}
+
+/**
+ * limbs_mul_high - multiply two limb vectors without their low limbs.
+ * @rp: where to store the un + vn - skip top limbs of the product, must not
+ * overlap up or vp
+ * @up: the first vector
+ * @un: number of limbs in up, at least 1
+ * @vp: the second vector
+ * @vn: number of limbs in vp, at least 1
+ * @skip: number of low limbs of the product to leave out, below un + vn
+ *
+ * Description: a short product, only the limb products up[i] * vp[j] with
+ * i + j >= skip are added up so about half the work of limbs_mul() is saved
+ * when skip is half the product. The dropped limb products and their carries
+ * are below skip * MAX_VAL_u4b^(skip + 1), so rp is never above the
+ * product's top limbs and, for skip < MAX_VAL_u4b - 1, less than 1 short in
+ * rp[2]. See MUL_HIGH_GUARD_LIMBS.
+ */
+void limbs_mul_high(uint32_t *rp, const uint32_t *up, size_t un,
+					const uint32_t *vp, size_t vn, size_t skip)
+{
+	size_t i = 0, j = 0;
+
+	memset(rp, 0, sizeof(*rp) * (un + vn - skip));
+	for (j = 0; j < vn; j++)
+	{
+		i = skip > j ? skip - j : 0;
+		if (i < un)
+			rp[un + j - skip] = limbs_addmul_1(&rp[i + j - skip], &up[i], un - i,
+											   vp[j]);
+	}
+}
+
+/**
+ * limbs_mul_high_wins - tell whether limbs_mul_high() is worth using.
+ * @un: number of limbs in the first vector
+ * @vn: number of limbs in the second vector
+ * @skip: number of low limbs of the product to leave out
+ *
+ * Description: the short product is schoolbook, so once limbs_mul() uses
+ * Karatsuba the full product is cheaper unless most of it is dropped. About
+ * 70 of the 128 limbs of a 64 x 64 product have to go, 1450 of the 2000 of
+ * a 1000 x 1000 one.
+ *
+ * Return: 1 if limbs_mul_high() should be used, 0 if the full product from
+ * limbs_mul() should be cut down instead.
+ */
+int limbs_mul_high_wins(size_t un, size_t vn, size_t skip)
+{
+	size_t j = 0, kept = 0;
+
+	for (j = 0; j < vn; j++)
+		kept += skip > j ? (skip - j < un ? un - (skip - j) : 0) : un;
+
+	return (kept * MUL_HIGH_RATIO <= limbs_mul_cost(un, vn));
+}
+
+/**
+ * limbs_divrem_itch - scratch space needed by limbs_divrem().
+ * @nn: number of limbs in the numerator
+ * @dn: number of limbs in the denominator
+ *
+ * Return: number of limbs of scratch space.
+ */
+size_t limbs_divrem_itch(size_t nn, size_t dn)
+{
+	/*Normalized copies of the numerator (+1 limb) and the denominator.*/
+	return (dn > 1 ? nn + 1 + dn : 0);
+}
+
+/**
+ * limbs_invert_limb - precompute a reciprocal for dividing by a limb.
+ * @d: the divisor, not zero
+ *
+ * Return: floor((2^64 - 1) / d), see limbs_divrem_1_preinv().
+ */
+uint64_t limbs_invert_limb(uint32_t d)
+{
+	return (UINT64_MAX / d);
+}
+
+/**
+ * div_preinv - divide a two limb number by a limb using its reciprocal.
+ * @num: the numerator, less than 2^63
+ * @d: the divisor, not zero
+ * @inverse: limbs_invert_limb(d)
+ * @rem: where to store the remainder
+ *
+ * Description: num * inverse / 2^64 is less than num / d by under 1, so the
+ * estimate is the quotient or one less, a single multiplication and a
+ * correction replace a 64 bit division.
+ *
+ * Return: num / d.
+ */
+uint64_t div_preinv(uint64_t num, uint32_t d, uint64_t inverse, uint64_t *rem)
+{
+	uint64_t q = 0, r = 0;
+
+#ifdef INFIX_HAS_INT128
+	q = __extension__((unsigned __int128)num * inverse) >> 64;
+#else
+	uint64_t n_lo = num & UINT32_MAX, n_hi = num >> 32;
+	uint64_t i_lo = inverse & UINT32_MAX, i_hi = inverse >> 32;
+	uint64_t mid1 = n_hi * i_lo, mid2 = n_lo * i_hi;
+	uint64_t carry = ((n_lo * i_lo >> 32) + (mid1 & UINT32_MAX) +
+					  (mid2 & UINT32_MAX)) >>
+					 32;
+
+	q = n_hi * i_hi + (mid1 >> 32) + (mid2 >> 32) + carry;
+#endif
+	r = num - q * d;
+	while (r >= d)
+	{
+		q++;
+		r -= d;
+	}
+
+	*rem = r;
+	return (q);
+}
+
+/**
+ * limbs_divrem_1_preinv - divide a limb vector by a single limb.
+ * @qp: where to store the n limbs of the quotient, may be up or NULL
+ * @up: the numerator
+ * @n: number of limbs in up
+ * @v: the denominator, not zero, less than MAX_VAL_u4b unless qp is NULL
+ * @inverse: limbs_invert_limb(v)
+ *
+ * Return: the remainder.
+ */
+uint32_t limbs_divrem_1_preinv(uint32_t *qp, const uint32_t *up, size_t n,
+							   uint32_t v, uint64_t inverse)
+{
+	uint64_t rem = 0, q = 0;
+	size_t i = n;
+
+	while (i-- > 0)
+	{
+		q = div_preinv(rem * MAX_VAL_u4b + up[i], v, inverse, &rem);
+		if (qp)
+			qp[i] = q;
+	}
+
+	return (rem);
+}
+
+/**
+ * limbs_mod_1s - reduce a limb vector by several moduli in one pass.
+ * @rp: where to store the count remainders
+ * @up: the numerator
+ * @n: number of limbs in up
+ * @moduli: the count moduli, none of them zero
+ * @inverses: limbs_invert_limb() of each modulus
+ * @count: number of moduli
+ *
+ * Description: every limb is read once and folded into all the remainders,
+ * r * MAX_VAL_u4b + limb is less than 2^63 for any 32 bit modulus.
+ */
+void limbs_mod_1s(uint32_t *rp, const uint32_t *up, size_t n,
+				  const uint32_t *moduli, const uint64_t *inverses, size_t count)
+{
+	uint64_t rem = 0;
+	size_t i = n, m = 0;
+
+	for (m = 0; m < count; m++)
+		rp[m] = 0;
+
+	while (i-- > 0)
+	{
+		for (m = 0; m < count; m++)
+		{
+			div_preinv((uint64_t)rp[m] * MAX_VAL_u4b + up[i], moduli[m],
+					   inverses[m], &rem);
+			rp[m] = rem;
+		}
+	}
+}
+
+/**
+ * limbs_divrem_preinv - divide by a denominator that has been normalized.
+ * @qp: where to store the nn - dn + 1 limbs of the quotient, NULL if it is
+ * not needed
+ * @rp: where to store the dn limbs of the remainder
+ * @np: the numerator
+ * @nn: number of limbs in np, at least dn
+ * @dp: the denominator multiplied by scale, see limbs_divrem()
+ * @dn: number of limbs in dp, at least 1
+ * @scale: MAX_VAL_u4b / (top limb of the denominator + 1), 1 if dn is 1
+ * @inverse: limbs_invert_limb() of dp's top limb
+ * @scratch: nn + 1 limbs of scratch space, unused if dn is 1. It may be rp if
+ * rp has room for nn + 1 limbs.
+ *
+ * Description: the denominator's part of limbs_divrem() is done by the
+ * caller, so it can be done once for many numerators. qp and rp must not
+ * overlap the operands.
+ */
+void limbs_divrem_preinv(uint32_t *qp, uint32_t *rp, const uint32_t *np,
+						 size_t nn, const uint32_t *dp, size_t dn,
+						 uint32_t scale, uint64_t inverse, uint32_t *scratch)
+{
+	uint32_t *un = scratch, borrow = 0;
+	uint64_t num = 0, qhat = 0, rhat = 0;
+	size_t j = 0;
+
+	if (dn == 1)
+	{
+		rp[0] = limbs_divrem_1_preinv(qp, np, nn, dp[0], inverse);
+		return;
+	}
+
+	un[nn] = limbs_mul_1(un, np, nn, scale);
+	for (j = nn - dn + 1; j-- > 0;)
+	{
+		num = (uint64_t)un[j + dn] * MAX_VAL_u4b + un[j + dn - 1];
+		qhat = div_preinv(num, dp[dn - 1], inverse, &rhat);
+		while (qhat >= MAX_VAL_u4b ||
+			   qhat * dp[dn - 2] > rhat * MAX_VAL_u4b + un[j + dn - 2])
+		{
+			qhat--;
+			rhat += dp[dn - 1];
+			if (rhat >= MAX_VAL_u4b)
+				break;
+		}
+
+		borrow = limbs_submul_1(&un[j], dp, dn, qhat);
+		if (un[j + dn] < borrow)
+		{
+			/*Rare, qhat was still one too big.*/
+			qhat--;
+			borrow -= limbs_add_n(&un[j], &un[j], dp, dn);
+		}
+
+		un[j + dn] -= borrow;
+		if (qp)
+			qp[j] = qhat;
+	}
+
+	/*Undo the scaling to get the remainder.*/
+	limbs_divrem_1(rp, un, dn, scale);
+}
+
+/**
+ * limbs_divrem - divide two limb vectors.
+ * @qp: where to store the nn - dn + 1 limbs of the quotient, NULL if it is
+ * not needed
+ * @rp: where to store the dn limbs of the remainder
+ * @np: the numerator
+ * @nn: number of limbs in np, at least dn
+ * @dp: the denominator, its top limb must not be zero
+ * @dn: number of limbs in dp, at least 1
+ * @scratch: limbs_divrem_itch(nn, dn) limbs of scratch space
+ *
+ * Description: Knuth's algorithm D. Both operands are scaled so that the
+ * denominator's top limb is at least MAX_VAL_u4b / 2, then every quotient limb
+ * estimated from the top two limbs is off by at most 2. qp and rp must not
+ * overlap the operands.
+ */
+void limbs_divrem(uint32_t *qp, uint32_t *rp, const uint32_t *np, size_t nn,
+				  const uint32_t *dp, size_t dn, uint32_t *scratch)
+{
+	uint32_t *vn = NULL, scale = 0;
+
+	if (dn == 1)
+	{
+		rp[0] = limbs_divrem_1(qp, np, nn, dp[0]);
+		return;
+	}
+
+	vn = &scratch[nn + 1];
+	scale = MAX_VAL_u4b / ((uint64_t)dp[dn - 1] + 1);
+	limbs_mul_1(vn, dp, dn, scale);
+	limbs_divrem_preinv(qp, rp, np, nn, vn, dn, scale,
+						limbs_invert_limb(vn[dn - 1]), scratch);
+}
+
+/**
+ * gcd_limb - greatest common divisor of two limbs.
+ * @a: the first limb
+ * @b: the second limb
+ *
+ * Return: gcd(a, b).
+ */
+uint32_t gcd_limb(uint32_t a, uint32_t b)
+{
+	uint32_t tmp = 0;
+
+	while (b)
+	{
+		tmp = a % b;
+		a = b;
+		b = tmp;
+	}
+
+	return (a);
+}
+
+/**
+ * invert_limb_mod - inverse of a limb modulo MAX_VAL_u4b.
+ * @d: the limb, must not be divisible by 2 or 5
+ *
+ * Return: x such that (d * x) % MAX_VAL_u4b = 1.
+ */
+uint32_t invert_limb_mod(uint32_t d)
+{
+	int64_t t = 0, new_t = 1, r = MAX_VAL_u4b, new_r = d, q = 0, tmp = 0;
+
+	/*Extended Euclid, only the coefficient of d is tracked.*/
+	while (new_r)
+	{
+		q = r / new_r;
+		tmp = t - q * new_t;
+		t = new_t;
+		new_t = tmp;
+		tmp = r - q * new_r;
+		r = new_r;
+		new_r = tmp;
+	}
+
+	return (t < 0 ? t + MAX_VAL_u4b : t);
+}
+
+/**
+ * limbs_divexact_itch - scratch space needed by limbs_divexact().
+ * @nn: number of limbs in the numerator
+ * @dn: number of limbs in the denominator
+ *
+ * Return: number of limbs of scratch space.
+ */
+size_t limbs_divexact_itch(size_t nn, size_t dn)
+{
+	/*Copies of the numerator and the denominator, divided in place.*/
+	return (nn + dn);
+}
+
+/**
+ * limbs_divexact - divide two limb vectors when the remainder is known to be 0.
+ * @qp: where to store the nn - dn + 1 limbs of the quotient, must not overlap
+ * the operands
+ * @np: the numerator, a multiple of dp
+ * @nn: number of limbs in np, at least dn
+ * @dp: the denominator, its top limb must not be zero
+ * @dn: number of limbs in dp, at least 1
+ * @scratch: limbs_divexact_itch(nn, dn) limbs of scratch space
+ *
+ * Description: Jebelean's exact division, the quotient is built from the low
+ * end: each quotient limb is the low limb of what is left of np times the
+ * inverse of dp's low limb modulo MAX_VAL_u4b, and nothing above the quotient's
+ * top limb is ever computed. The inverse only exists when dp's low limb is not
+ * divisible by 2 or 5, so common low zero limbs and factors of 2 and 5 are
+ * divided out of both operands first. The quotient is garbage if np is not a
+ * multiple of dp.
+ */
+void limbs_divexact(uint32_t *qp, const uint32_t *np, size_t nn,
+					const uint32_t *dp, size_t dn, uint32_t *scratch)
+{
+	uint32_t *un = scratch, *vn = &scratch[nn], inverse = 0, g = 0;
+	uint32_t q = 0, borrow = 0;
+	size_t qn = nn - dn + 1, i = 0, len = 0;
+
+	memcpy(un, np, sizeof(*np) * nn);
+	memcpy(vn, dp, sizeof(*dp) * dn);
+	/*n / d = (n / B) / (d / B) when both end in zero limbs.*/
+	while (!vn[0])
+	{
+		un++;
+		vn++;
+		nn--;
+		dn--;
+	}
+
+	/*Dividing out a factor keeps the lengths, so qn still fits qp.*/
+	for (g = gcd_limb(vn[0], MAX_VAL_u4b); g > 1; g = gcd_limb(vn[0], MAX_VAL_u4b))
+	{
+		limbs_divrem_1(un, un, nn, g);
+		limbs_divrem_1(vn, vn, dn, g);
+	}
+
+	inverse = invert_limb_mod(vn[0]);
+	for (i = 0; i < qn; i++)
+	{
+		q = (uint64_t)un[i] * inverse % MAX_VAL_u4b;
+		qp[i] = q;
+		/*Only the limbs below the quotient's top are needed.*/
+		len = dn < qn - i ? dn : qn - i;
+		borrow = limbs_submul_1(&un[i], vn, len, q);
+		if (borrow && i + len < qn)
+			limbs_sub(&un[i + len], &un[i + len], qn - i - len, &borrow, 1);
+	}
+}
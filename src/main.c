@@ -1,5 +1,8 @@
 #include "infiX.h"
 
+static int parse_flag(const char *flag, output_format *format) ATTR_NONNULL;
+static int parse_count(const char *count_str, size_t *count) ATTR_NONNULL;
+
 /**
  * main - entry point
  * @argc: number of arguments
@@ -10,15 +13,27 @@
 int main(int argc, char *argv[])
 {
 	char *answer = NULL;
+	output_format format = {OUTPUT_FULL, 0};
+	int i = 1;
 
 	errno = 0;
-	if (argc < 3)
+	/*Flags come before the numbers, a number never starts with "--".*/
+	for (; i < argc && !strncmp(argv[i], "--", 2); i++)
+	{
+		if (parse_flag(argv[i], &format))
+		{
+			panic("flags");
+			return (EXIT_FAILURE);
+		}
+	}
+
+	if (argc - i < 2)
 	{
 		panic((const char *)NULL);
 		return (EXIT_FAILURE);
 	}
 
-	answer = infiX_manager(argv[1], argv[2], argv[3]);
+	answer = infiX_manager(argv[i], argv[i + 1], argv[i + 2], &format);
 	if (!answer)
 		return (EXIT_FAILURE);
 
@@ -26,3 +41,74 @@ int main(int argc, char *argv[])
 	answer = free_n_null(answer);
 	return (EXIT_SUCCESS);
 }
+
+/**
+ * parse_flag - set the output format from a command line flag.
+ * @flag: "--digits", "--first=K", "--last=K" or "--sci[=P]"
+ * @format: the format to set
+ *
+ * Return: 0 on success, -1 if the flag is not recognised or K is 0
+ */
+int parse_flag(const char *flag, output_format *format)
+{
+	if (!strcmp(flag, "--digits"))
+	{
+		format->mode = OUTPUT_DIGIT_COUNT;
+		return (0);
+	}
+
+	if (!strcmp(flag, "--sci"))
+	{
+		format->mode = OUTPUT_SCIENTIFIC;
+		format->digits = 6;
+		return (0);
+	}
+
+	if (!strncmp(flag, "--sci=", 6))
+	{
+		format->mode = OUTPUT_SCIENTIFIC;
+		return (parse_count(&flag[6], &format->digits));
+	}
+
+	/*No digits at all would only print an empty line.*/
+	if (!strncmp(flag, "--first=", 8))
+	{
+		format->mode = OUTPUT_FIRST_DIGITS;
+		return (parse_count(&flag[8], &format->digits) || !format->digits ? -1 : 0);
+	}
+
+	if (!strncmp(flag, "--last=", 7))
+	{
+		format->mode = OUTPUT_LAST_DIGITS;
+		return (parse_count(&flag[7], &format->digits) || !format->digits ? -1 : 0);
+	}
+
+	return (-1);
+}
+
+/**
+ * parse_count - read the number of digits given to a flag.
+ * @count_str: a string of decimal digits
+ * @count: where to store the number
+ *
+ * Return: 0 on success, -1 if the string is not a number that fits a size_t
+ */
+int parse_count(const char *count_str, size_t *count)
+{
+	size_t i = 0;
+
+	*count = 0;
+	if (!count_str[0])
+		return (-1);
+
+	for (i = 0; count_str[i]; i++)
+	{
+		if (count_str[i] < '0' || count_str[i] > '9' ||
+			*count > (SIZE_MAX - (size_t)(count_str[i] - '0')) / 10)
+			return (-1);
+
+		*count = *count * 10 + (size_t)(count_str[i] - '0');
+	}
+
+	return (0);
+}
@@ -1,14 +1,107 @@
 #include "infiX.h"
 
+static void *libc_alloc(size_t size, void *ctx);
+static void *libc_realloc(void *ptr, size_t size, void *ctx);
+static void libc_free(void *ptr, void *ctx);
+static const allocator_hooks *current_hooks(void);
+
+/*Hooks used when none have been set.*/
+static const allocator_hooks libc_hooks = {
+	.alloc = libc_alloc, .realloc = libc_realloc, .free = libc_free, .ctx = NULL};
+static _Atomic(const allocator_hooks *) process_hooks = &libc_hooks;
+static _Thread_local const allocator_hooks *thread_hooks;
+
+/**
+ * libc_alloc - allocator_hooks alloc using malloc.
+ * @size: size in bytes to allocate.
+ * @ctx: unused.
+ *
+ * Return: a pointer to the memory area, NULL on failure.
+ */
+void *libc_alloc(size_t size, void *ctx)
+{
+	(void)ctx;
+	return (malloc(size));
+}
+
+/**
+ * libc_realloc - allocator_hooks realloc using realloc.
+ * @ptr: pointer to the memory area to resize, may be NULL.
+ * @size: the new size in bytes.
+ * @ctx: unused.
+ *
+ * Return: a pointer to the memory area, NULL on failure.
+ */
+void *libc_realloc(void *ptr, size_t size, void *ctx)
+{
+	(void)ctx;
+	return (realloc(ptr, size));
+}
+
+/**
+ * libc_free - allocator_hooks free using free.
+ * @ptr: a freeable pointer.
+ * @ctx: unused.
+ */
+void libc_free(void *ptr, void *ctx)
+{
+	(void)ctx;
+	free(ptr);
+}
+
+/**
+ * set_allocator_hooks - set the allocator used by every thread.
+ * @hooks: the new allocator, NULL to go back to malloc/realloc/free.
+ *
+ * Description: hooks is not copied, it must stay valid for as long as any
+ * memory allocated with it is in use. Limb buffers remember their allocator
+ * and are always freed with it, everything else must be freed while the same
+ * hooks are in effect.
+ *
+ * Return: the previous hooks.
+ */
+const allocator_hooks *set_allocator_hooks(const allocator_hooks *hooks)
+{
+	return (atomic_exchange(&process_hooks, hooks ? hooks : &libc_hooks));
+}
+
+/**
+ * set_thread_allocator_hooks - set the allocator used by the calling thread.
+ * @hooks: the new allocator, NULL to use the process wide one again.
+ *
+ * Description: overrides set_allocator_hooks() for this thread only, e.g. to
+ * use a per request arena. The same lifetime rules apply.
+ *
+ * Return: the previous hooks of this thread, NULL if it had none.
+ */
+const allocator_hooks *set_thread_allocator_hooks(const allocator_hooks *hooks)
+{
+	const allocator_hooks *previous = thread_hooks;
+
+	thread_hooks = hooks;
+	return (previous);
+}
+
+/**
+ * current_hooks - get the allocator in effect for the calling thread.
+ *
+ * Return: pointer to the hooks.
+ */
+const allocator_hooks *current_hooks(void)
+{
+	return (thread_hooks ? thread_hooks : atomic_load(&process_hooks));
+}
+
 /**
- * xmalloc - allocate memory with malloc and check for failure.
+ * xmalloc - allocate memory and check for failure.
  * @size: size in bytes to allocate.
  *
  * Return: a pointer to the memory area, NULL on failure.
  */
 void *xmalloc(size_t size)
 {
-	void *ptr = malloc(size);
+	const allocator_hooks *hooks = current_hooks();
+	void *ptr = hooks->alloc(size, hooks->ctx);
 
 	if (!ptr && size)
 		perror("Memory allocation failed.");
@@ -17,7 +110,7 @@ void *xmalloc(size_t size)
 }
 
 /**
- * xcalloc - allocate memory with calloc and check for failure.
+ * xcalloc - allocate zeroed memory and check for failure.
  * @items: number of items to allocate memory for.
  * @sizeof_item: the size in bytes of each item.
  *
@@ -25,14 +118,149 @@ void *xmalloc(size_t size)
  */
 void *xcalloc(size_t items, size_t sizeof_item)
 {
-	void *ptr = calloc(items, sizeof_item);
+	void *ptr = NULL;
 
-	if (!ptr && items * sizeof_item != 0)
+	if (sizeof_item && items > SIZE_MAX / sizeof_item)
+	{
+		errno = ENOMEM;
 		perror("Memory allocation failed.");
+		return (NULL);
+	}
+
+	ptr = xmalloc(items * sizeof_item);
+	if (ptr)
+		memset(ptr, 0, items * sizeof_item);
 
 	return (ptr);
 }
 
+/**
+ * xrealloc - reallocate memory and check for failure.
+ * @ptr: pointer to the memory area to resize, may be NULL.
+ * @size: the new size in bytes.
+ *
+ * Return: a pointer to the memory area, NULL on failure (ptr is untouched).
+ */
+void *xrealloc(void *ptr, size_t size)
+{
+	const allocator_hooks *hooks = current_hooks();
+	void *new_ptr = hooks->realloc(ptr, size, hooks->ctx);
+
+	if (!new_ptr && size)
+		perror("Memory allocation failed.");
+
+	return (new_ptr);
+}
+
+/**
+ * limbs_block_size - size of the block holding a buffer of limbs.
+ * @capacity: number of limbs in the buffer.
+ *
+ * Return: size in bytes, with room for the header and for aligning the limbs.
+ */
+static size_t limbs_block_size(size_t capacity)
+{
+	return (LIMB_ALIGNMENT - 1 + sizeof(limb_header) + sizeof(uint32_t) * capacity);
+}
+
+/**
+ * align_limbs - find where the limbs go in a block.
+ * @block: a block of limbs_block_size() bytes.
+ *
+ * Return: the first LIMB_ALIGNMENT boundary with room for a header before it.
+ */
+static uint32_t *align_limbs(void *block)
+{
+	uintptr_t limbs = (uintptr_t)block + sizeof(limb_header);
+
+	limbs = (limbs + LIMB_ALIGNMENT - 1) & ~(uintptr_t)(LIMB_ALIGNMENT - 1);
+	return ((uint32_t *)limbs);
+}
+
+/**
+ * padded_capacity - round a capacity up to a whole number of vectors.
+ * @capacity: number of limbs.
+ *
+ * Return: the smallest multiple of LIMB_PADDING not less than capacity.
+ */
+static size_t padded_capacity(size_t capacity)
+{
+	return ((capacity + LIMB_PADDING - 1) / LIMB_PADDING * LIMB_PADDING);
+}
+
+/**
+ * alloc_limbs - allocate a reference counted, zeroed buffer of limbs.
+ * @capacity: number of limbs in the buffer, a multiple of LIMB_PADDING.
+ *
+ * Description: the reference count is kept in a limb_header placed right in
+ * front of the limbs, the returned pointer is to the first limb and is
+ * LIMB_ALIGNMENT aligned.
+ *
+ * Return: pointer to the limbs, NULL on failure.
+ */
+static uint32_t *alloc_limbs(size_t capacity)
+{
+	const allocator_hooks *hooks = current_hooks();
+	void *block = hooks->alloc(limbs_block_size(capacity), hooks->ctx);
+	uint32_t *limbs = NULL;
+	limb_header *header = NULL;
+
+	if (!block)
+	{
+		perror("Memory allocation failed.");
+		return (NULL);
+	}
+
+	limbs = align_limbs(block);
+	memset(limbs, 0, sizeof(*limbs) * capacity);
+	header = (limb_header *)limbs - 1;
+	atomic_init(&header->refs, 1);
+	header->hooks = hooks;
+	header->block = block;
+	return (limbs);
+}
+
+/**
+ * limbs_header - get the limb_header of an owned buffer.
+ * @arr: a u4b_array with a capacity greater than 0.
+ *
+ * Return: pointer to the header.
+ */
+static limb_header *limbs_header(const u4b_array *arr)
+{
+	return ((limb_header *)arr->array - 1);
+}
+
+/**
+ * release_limbs - drop a u4b_array's reference to its buffer.
+ * @arr: pointer to the u4b_array struct.
+ *
+ * Description: the buffer is freed once the last reference is dropped.
+ * Buffers not owned by the struct are left alone.
+ */
+static void release_limbs(u4b_array *arr)
+{
+	limb_header *header = arr->capacity ? limbs_header(arr) : NULL;
+
+	if (header && atomic_fetch_sub_explicit(&header->refs, 1, memory_order_acq_rel) == 1)
+		header->hooks->free(header->block, header->hooks->ctx);
+
+	arr->array = NULL;
+	arr->capacity = 0;
+}
+
+/**
+ * is_shared_u4b_array - check if a u4b_array's buffer has other owners.
+ * @arr: pointer to the u4b_array struct.
+ *
+ * Return: 1 if the buffer is shared, 0 if not.
+ */
+int is_shared_u4b_array(const u4b_array *arr)
+{
+	return (arr && arr->capacity &&
+			atomic_load_explicit(&limbs_header(arr)->refs, memory_order_acquire) > 1);
+}
+
 /**
  * alloc_u4b_array - allocates memory for a u4b_array of a given length
  * @len: length of the array, length 0 returns the struct with a NULL array
@@ -49,23 +277,209 @@ u4b_array *alloc_u4b_array(size_t len)
 	arr->len = len;
 	if (len > 0)
 	{
-		arr->array = xcalloc(len, sizeof(*arr->array));
+		arr->array = alloc_limbs(padded_capacity(len));
 		if (!arr->array)
 			arr = free_n_null(arr);
+		else
+			arr->capacity = padded_capacity(len);
 	}
 
 	return (arr);
 }
 
+/**
+ * dup_u4b_array - duplicate a u4b_array.
+ * @arr: pointer to the u4b_array struct.
+ *
+ * Description: owned buffers are not copied, the duplicate shares the buffer
+ * and takes a reference to it. Whichever of them is written to first gets its
+ * own copy (copy-on-write). Buffers not owned by the struct (capacity 0) can
+ * not be reference counted and are copied.
+ *
+ * Return: pointer to the duplicate, NULL on failure.
+ */
+u4b_array *dup_u4b_array(const u4b_array *arr)
+{
+	u4b_array *copy = NULL;
+
+	if (!arr)
+		return (NULL);
+
+	if (!arr->capacity)
+	{
+		copy = alloc_u4b_array(arr->array ? arr->len : 0);
+		if (copy && copy->len)
+			memmove(copy->array, arr->array, sizeof(*arr->array) * arr->len);
+
+		if (copy)
+			copy->is_negative = arr->is_negative;
+
+		return (copy);
+	}
+
+	copy = xmalloc(sizeof(*copy));
+	if (!copy)
+		return (NULL);
+
+	*copy = *arr;
+	atomic_fetch_add_explicit(&limbs_header(arr)->refs, 1, memory_order_relaxed);
+	return (copy);
+}
+
+/**
+ * reserve_u4b_array - make sure a u4b_array can hold a number of items.
+ * @arr: pointer to the u4b_array struct.
+ * @capacity: minimum number of items the array should be able to hold.
+ *
+ * Description: the capacity grows geometrically (at least doubling) so that
+ * repeatedly growing an array only reallocates a logarithmic number of times,
+ * and is rounded up to a multiple of LIMB_PADDING.
+ * Shared buffers and buffers not owned by the struct (capacity 0) are copied
+ * into a new buffer, so on success the array can always be written to.
+ * Newly allocated items are zeroed, len is not changed.
+ *
+ * Return: 0 on success, -1 on failure (arr is untouched).
+ */
+int reserve_u4b_array(u4b_array *arr, size_t capacity)
+{
+	size_t new_capacity = 0, kept = 0;
+	ptrdiff_t offset = 0;
+	uint32_t *new_array = NULL;
+	limb_header *header = NULL;
+	const allocator_hooks *hooks = NULL;
+	void *block = NULL;
+	int is_shared = is_shared_u4b_array(arr);
+
+	if (!arr)
+		return (-1);
+
+	if (capacity <= arr->capacity && !is_shared)
+		return (0);
+
+	new_capacity = arr->capacity;
+	if (capacity > arr->capacity)
+		new_capacity = (arr->capacity * 2 < capacity) ? capacity : arr->capacity * 2;
+
+	/*Copies keep all of the current items.*/
+	kept = arr->array ? arr->len : 0;
+	if (new_capacity < kept)
+		new_capacity = kept;
+
+	if (!new_capacity)
+		return (0);
+
+	new_capacity = padded_capacity(new_capacity);
+	if (arr->capacity && !is_shared)
+	{
+		/*Resized with the allocator it came from.*/
+		header = limbs_header(arr);
+		hooks = header->hooks;
+		offset = (char *)arr->array - (char *)header->block;
+		block = hooks->realloc(header->block, limbs_block_size(new_capacity), hooks->ctx);
+		if (!block)
+		{
+			perror("Memory allocation failed.");
+			return (-1);
+		}
+
+		/*The block may have moved to an address with a different alignment.*/
+		new_array = align_limbs(block);
+		if ((char *)new_array - (char *)block != offset)
+			memmove((limb_header *)new_array - 1, (char *)block + offset - sizeof(*header),
+					sizeof(*header) + sizeof(*new_array) * arr->capacity);
+
+		header = (limb_header *)new_array - 1;
+		header->block = block;
+		memset(&new_array[arr->capacity], 0,
+			   sizeof(*new_array) * (new_capacity - arr->capacity));
+	}
+	else
+	{
+		new_array = alloc_limbs(new_capacity);
+		if (!new_array)
+			return (-1);
+
+		if (kept)
+			memmove(new_array, arr->array, sizeof(*new_array) * kept);
+
+		release_limbs(arr);
+		arr->len = kept;
+	}
+
+	arr->array = new_array;
+	arr->capacity = new_capacity;
+	return (0);
+}
+
+/**
+ * unshare_u4b_array - give a u4b_array its own copy of a shared buffer.
+ * @arr: pointer to the u4b_array struct.
+ *
+ * Description: must be called before writing to the array directly,
+ * resize_u4b_array and reserve_u4b_array already do this.
+ *
+ * Return: 0 on success, -1 on failure (arr is untouched).
+ */
+int unshare_u4b_array(u4b_array *arr)
+{
+	return (reserve_u4b_array(arr, 0));
+}
+
+/**
+ * resize_u4b_array - change the number of items in a u4b_array.
+ * @arr: pointer to the u4b_array struct.
+ * @len: the new length of the array.
+ *
+ * Description: the items between the old and new lengths are zeroed, whether
+ * growing or shrinking. The buffer is reused when its capacity is large
+ * enough and it is not shared.
+ *
+ * Return: 0 on success, -1 on failure (arr is untouched).
+ */
+int resize_u4b_array(u4b_array *arr, size_t len)
+{
+	if (!arr || reserve_u4b_array(arr, len))
+		return (-1);
+
+	/*Items past len are always zero in owned buffers.*/
+	if (len > arr->len)
+		memset(&arr->array[arr->len], 0, sizeof(*arr->array) * (len - arr->len));
+	else if (arr->capacity)
+		memset(&arr->array[len], 0, sizeof(*arr->array) * (arr->len - len));
+
+	arr->len = len;
+	return (0);
+}
+
+/**
+ * move_u4b_array - move the contents of one u4b_array into another.
+ * @dest: the u4b_array to overwrite, its old buffer is released.
+ * @src: the u4b_array to move from, the struct is freed.
+ *
+ * Return: dest, or src if dest is NULL.
+ */
+u4b_array *move_u4b_array(u4b_array *dest, u4b_array *src)
+{
+	if (!dest || !src)
+		return (src);
+
+	release_limbs(dest);
+	*dest = *src;
+	free_n_null(src);
+	return (dest);
+}
+
 /**
  * free_n_null - free a pointer, return NULL.
- * @ptr: a freeable pointer.
+ * @ptr: a pointer from xmalloc(), xcalloc() or xrealloc(), may be NULL.
  *
  * Return: NULL always.
  */
 void *free_n_null(void *ptr)
 {
-	free(ptr);
+	const allocator_hooks *hooks = current_hooks();
+
+	hooks->free(ptr, hooks->ctx);
 	return (NULL);
 }
 
@@ -73,12 +487,15 @@ void *free_n_null(void *ptr)
  * free_u4b_array - free a u4b_array, return NULL.
  * @arr: a pointer to a u4b_array.
  *
+ * Description: the array is only freed if it is owned by the struct and
+ * this was the last reference to it.
+ *
  * Return: NULL always.
  */
 void *free_u4b_array(u4b_array *arr)
 {
 	if (arr)
-		free_n_null(arr->array);
+		release_limbs(arr);
 
 	return (free_n_null(arr));
 }
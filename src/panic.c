@@ -4,7 +4,10 @@
 /*"base" - unrecognised base*/
 /*"ops" - unrecognised operand*/
 /*"division by zero" - ...*/
-/*"unrecognised characters" - ...*/
+/*"invalid char" - character that is not a digit or a separator*/
+/*"flags" - unrecognised flag or digit count*/
+/*"digits" - number without a digit, e.g. "0x"*/
+/*"exponent" - exponent that is not a whole number or has no digits before it*/
 
 /**
  * panic - app misuse error handler
@@ -14,25 +17,54 @@ void panic(const char *err_type)
 {
 	if (!err_type || (err_type && err_type[0] == 'H'))
 		help_me(err_type);
-	else if (!strcmp(err_type, "invlaid chars"))
+	else if (!strcmp(err_type, "invalid char"))
 	{
 		fprintf(stderr, "The string contains an invalid character. ");
-		fprintf(stderr, "Valid characters [0-9].\n");
+		fprintf(stderr, "Valid characters [0-9], [a-f] after \"0x\" and ");
+		fprintf(stderr, "the separators ',', ' ' and '_' (decimal only).\n");
 	}
 	else if (!strcmp(err_type, "base"))
 	{
-		fprintf(stderr, "Only decimals (0-9) are currently supported.\n");
+		fprintf(stderr, "Bases 2 to 36 are supported, the digits past 9 ");
+		fprintf(stderr, "are letters.\nPrefix hexadecimal numbers with ");
+		fprintf(stderr, "\"0x\", octal with \"0o\" and binary with \"0b\".\n");
 	}
 	else if (!strcmp(err_type, "ops"))
 	{
-		fprintf(stderr, "OPERATORS:\n'+', '-', 'x', '/', '%%'\n");
+		fprintf(stderr, "OPERATORS:\n'+', '-', 'x', '/', '%%', '&', '|', '^', ");
+		fprintf(stderr, "'~', '<<', '>>'\n");
+	}
+	else if (!strcmp(err_type, "exponent"))
+	{
+		fprintf(stderr, "Exponents must be whole numbers after some digits, ");
+		fprintf(stderr, "e.g. 3e50 or 1_000E+12.\n");
+	}
+	else if (!strcmp(err_type, "digits"))
+	{
+		fprintf(stderr, "Numbers need at least one digit, e.g. 0xff ");
+		fprintf(stderr, "rather than 0x.\n");
+	}
+	else if (!strcmp(err_type, "flags"))
+	{
+		fprintf(stderr, "FLAGS:\n--digits, --first=K, --last=K, --sci[=P]\n");
+		fprintf(stderr, "K (at least 1) and P are numbers of digits.\n");
 	}
 	else
 	{
-		fprintf(stderr, "USAGE: num1 operator [num2]\n");
+		fprintf(stderr, "USAGE: [flags] num1 operator [num2]\n");
 	}
 }
 
+/**
+ * panic_digit - error handler for a digit too big for its base
+ * @digit: the digit, e.g. 'g'
+ * @base: the base it was read in
+ */
+void panic_digit(char digit, unsigned int base)
+{
+	fprintf(stderr, "The digit '%c' is not valid in base %u.\n", digit, base);
+}
+
 /**
  * help_me - print help text
  * @which_help: a string specifying which text to print
@@ -43,26 +75,34 @@ void help_me(const char *which_help)
 	{
 		printf("OPERATORS:\n'+': addition, '-': subtraction,");
 		printf(" 'x': multiplication, '/': division,\n'%%': ");
-		printf("modulus.\n");
+		printf("modulus, '&': and, '|': or, '^': xor, '~': not,\n");
+		printf("'<<': shift left, '>>': shift right (in bits).\n");
 	}
 	else if (which_help && !strcmp(which_help, "Hbase"))
 	{
-		fprintf(stderr, "Only decimals (0-9) are currently supported.\n");
+		fprintf(stderr, "Bases 2 to 36 are supported, the digits past 9 ");
+		fprintf(stderr, "are letters.\n");
 		fprintf(stderr, "-Any character that does not represent a number in ");
 		fprintf(stderr, "the specified base will\n");
 		fprintf(stderr, " cause the rest of the string to be ignored.\n");
 	}
 	else if (which_help && !strcmp(which_help, "Husage"))
 	{
-		printf("USAGE:\n%s num1 operator [num2]\n", program_invocation_name);
+		printf("USAGE:\n%s [flags] num1 operator [num2]\n",
+			   program_invocation_name);
 		printf("For operators requring two numbers, second number will be ");
 		printf("assumed as 0\n.if not given.\n");
 	}
 	else
 	{
 		printf("USAGE:\n");
-		printf("%s num1 operator [num2]\n", program_invocation_name);
-		printf("Operators: '+' '-' 'x'  '/' '%%'.\n");
-		printf("Only decimals (base 10) are currently supported.\n");
+		printf("%s [flags] num1 operator [num2]\n", program_invocation_name);
+		printf("Operators: '+' '-' 'x'  '/' '%%' '&' '|' '^' '~' '<<' '>>'.\n");
+		printf("Numbers are decimal, or hexadecimal, octal or binary ");
+		printf("with a \"0x\", \"0o\" or \"0b\" prefix.\n");
+		printf("Flags: '--digits' prints the number of digits of the answer, ");
+		printf("'--first=K' and\n'--last=K' its first or last K digits and ");
+		printf("'--sci[=P]' the answer as d.ddde+N\nwith P digits after the ");
+		printf("point (6 by default).\n");
 	}
 }
@@ -1,18 +1,21 @@
 #include "infiX.h"
 
 static math_function *get_math_function(char *op_symbol);
+static u4b_array *str_to_number(const char *num_str);
 
 /**
  * infiX_manager - determine what operation to carry out based on given symbol
  * @num1: first number
  * @op_symbol: operand
  * @num2: second number
+ * @format: how the answer is written, NULL for every digit
  *
  * Return: Pointer to answer string on sucess, NULL on failure
  */
-char *infiX_manager(char *num1, char *op_symbol, char *num2)
+char *infiX_manager(char *num1, char *op_symbol, char *num2,
+				   const output_format *format)
 {
-	uint32_t *num1_arr = NULL, *num2_arr = NULL, *ans_arr = NULL;
+	u4b_array *num1_arr = NULL, *num2_arr = NULL, *ans_arr = NULL;
 	char *answer = NULL;
 	math_function *func_ptr = NULL;
 
@@ -22,37 +25,89 @@ char *infiX_manager(char *num1, char *op_symbol, char *num2)
 		return (NULL);
 	}
 
+	/*Numbers that fit in a machine word skip the arrays altogether.*/
+	answer = infiX_small(num1, op_symbol, num2);
+	if (answer && format && format->mode != OUTPUT_FULL)
+	{
+		/*Small answers are cheap to convert back and format.*/
+		ans_arr = str_to_intarray(answer);
+		answer = free_n_null(answer);
+		if (ans_arr)
+			answer = format_intarr(ans_arr, format);
+
+		ans_arr = free_u4b_array(ans_arr);
+		return (answer);
+	}
+
+	if (answer)
+		return (answer);
+
 	func_ptr = get_math_function(op_symbol);
 	if (func_ptr)
 	{
 		errno = 0;
-		/*Convert num1 and num2 to uint32_t arrays first*/
-		num1_arr = str_to_intarray(num1);
+		/*Convert num1 and num2 to u4b_arrays first*/
+		num1_arr = str_to_number(num1);
 		if (num1_arr)
-			num2_arr = str_to_intarray(num2);
+			num2_arr = str_to_number(num2);
 
 		if (num1_arr && num2_arr)
 			ans_arr = func_ptr(num1_arr, num2_arr);
+
+		free_radix_powers();
 	}
 
-	num1_arr = free_n_null(num1_arr);
-	num2_arr = free_n_null(num2_arr);
+	num1_arr = free_u4b_array(num1_arr);
+	num2_arr = free_u4b_array(num2_arr);
 	if (ans_arr)
-	{
-		if (!strcmp(op_symbol, "%"))
-			answer = intarr_to_str(remains);
-		else
-			answer = intarr_to_str(ans_arr);
-	}
+		answer = format_intarr(ans_arr, format);
 
-	remains = free_n_null(remains);
-	ans_arr = free_n_null(ans_arr);
+	ans_arr = free_u4b_array(ans_arr);
 	if (!func_ptr)
 		panic("ops"); /*Symbol not found*/
 
 	return (answer);
 }
 
+/**
+ * str_to_number - convert a number argument to a u4b_array.
+ * @num_str: a decimal number, or a hexadecimal, octal or binary one if it
+ * starts with "0x", "0o" or "0b" (after the sign)
+ *
+ * Return: pointer to a normalized u4b_array, NULL on failure
+ */
+u4b_array *str_to_number(const char *num_str)
+{
+	u4b_array *arr = NULL;
+	size_t i = 0;
+	unsigned int base = 10;
+
+	if (num_str && num_str[0] == '-')
+		i++;
+
+	if (num_str && num_str[i] == '0' && num_str[i + 1])
+	{
+		if (tolower((unsigned char)num_str[i + 1]) == 'x')
+			base = 16;
+		else if (tolower((unsigned char)num_str[i + 1]) == 'o')
+			base = 8;
+		else if (tolower((unsigned char)num_str[i + 1]) == 'b')
+			base = 2;
+	}
+
+	if (base == 10)
+		return (str_to_intarray(num_str));
+
+	arr = radix_to_intarray(&num_str[i + 2], base);
+	if (arr)
+	{
+		arr->is_negative = (i == 1);
+		trim_u4b_array(arr);
+	}
+
+	return (arr);
+}
+
 /**
  * get_math_function - return the function associated with the give operator
  * @op_symbol: the operator symbol
@@ -67,7 +122,13 @@ math_function *get_math_function(char *op_symbol)
 		{"-", infiX_subtraction},
 		{"x", infiX_multiplication},
 		{"/", infiX_division},
-		{"%", infiX_division},
+		{"%", infiX_modulus},
+		{"&", infiX_and},
+		{"|", infiX_or},
+		{"^", infiX_xor},
+		{"~", infiX_not},
+		{"<<", infiX_lshift},
+		{">>", infiX_rshift},
 		{NULL, NULL},
 	};
 
@@ -0,0 +1,467 @@
+#include "infiX.h"
+
+/**
+ * struct run_cursor - a position in the runs of a sparse_u4b
+ * @n: the number
+ * @run: index of the first run that does not end before the position
+ * @limb: index in n->limbs of that run's first limb
+ */
+typedef struct run_cursor
+{
+	const sparse_u4b *n;
+	size_t run;
+	size_t limb;
+} run_cursor;
+
+static sparse_u4b *alloc_sparse_u4b(void) ATTR_MALLOC;
+static int push_limb(sparse_u4b *n, size_t offset, uint32_t limb) ATTR_NONNULL;
+static size_t cursor_next(run_cursor *c, size_t pos) ATTR_NONNULL;
+static uint32_t cursor_limb(run_cursor *c, size_t pos) ATTR_NONNULL;
+static ssize_t cmp_magnitudes(const sparse_u4b *n1, const sparse_u4b *n2) ATTR_NONNULL;
+static int add_magnitudes(sparse_u4b *r, const sparse_u4b *n1, const sparse_u4b *n2)
+	ATTR_NONNULL;
+static int sub_magnitudes(sparse_u4b *r, const sparse_u4b *n1, const sparse_u4b *n2)
+	ATTR_NONNULL;
+static sparse_u4b *add_signed(const sparse_u4b *n1, const sparse_u4b *n2, char negate2)
+	ATTR_NONNULL;
+
+/**
+ * alloc_sparse_u4b - allocate a sparse_u4b holding zero.
+ *
+ * Return: the number, NULL on failure
+ */
+sparse_u4b *alloc_sparse_u4b(void)
+{
+	return (xcalloc(1, sizeof(sparse_u4b)));
+}
+
+/**
+ * push_limb - append a limb to a sparse_u4b.
+ * @n: the number
+ * @offset: index of the limb in the dense number, after every limb pushed so
+ * far
+ * @limb: the limb, zero limbs are not stored
+ *
+ * Description: the limb extends the last run if the zero gap before it is
+ * shorter than SPARSE_MIN_GAP, the gap is then stored as well.
+ *
+ * Return: 0 on success, -1 on failure (n is unchanged)
+ */
+int push_limb(sparse_u4b *n, size_t offset, uint32_t limb)
+{
+	limb_run *last = n->nruns ? &n->runs[n->nruns - 1] : NULL, *runs = NULL;
+	size_t gap = last ? offset - (last->offset + last->len) : 0, size = 0;
+	uint32_t *limbs = NULL;
+
+	if (!limb)
+		return (0);
+
+	if (!last || gap >= SPARSE_MIN_GAP)
+		gap = 0;
+
+	if (n->nlimbs + gap + 1 > n->limbs_capacity)
+	{
+		size = n->limbs_capacity * 2 + SPARSE_MIN_GAP;
+		limbs = xrealloc(n->limbs, sizeof(*limbs) * size);
+		if (!limbs)
+			return (-1);
+
+		n->limbs = limbs;
+		n->limbs_capacity = size;
+	}
+
+	if (last && (gap || offset == last->offset + last->len))
+	{
+		memset(&n->limbs[n->nlimbs], 0, sizeof(*n->limbs) * gap);
+		last->len += gap + 1;
+	}
+	else
+	{
+		if (n->nruns == n->runs_capacity)
+		{
+			size = n->runs_capacity * 2 + 1;
+			runs = xrealloc(n->runs, sizeof(*runs) * size);
+			if (!runs)
+				return (-1);
+
+			n->runs = runs;
+			n->runs_capacity = size;
+		}
+
+		n->runs[n->nruns].offset = offset;
+		n->runs[n->nruns].len = 1;
+		n->nruns++;
+	}
+
+	n->nlimbs += gap;
+	n->limbs[n->nlimbs++] = limb;
+	n->len = offset + 1;
+	return (0);
+}
+
+/**
+ * cursor_next - find the next limb stored in a run.
+ * @c: the cursor, moved forward to the run holding the limb
+ * @pos: the position to start from, not before any earlier position
+ *
+ * Return: the position of the first stored limb at or after pos, SIZE_MAX if
+ * there is none (every limb from pos up is zero).
+ */
+size_t cursor_next(run_cursor *c, size_t pos)
+{
+	const limb_run *runs = c->n->runs;
+
+	while (c->run < c->n->nruns && runs[c->run].offset + runs[c->run].len <= pos)
+	{
+		c->limb += runs[c->run].len;
+		c->run++;
+	}
+
+	if (c->run == c->n->nruns)
+		return (SIZE_MAX);
+
+	return (runs[c->run].offset > pos ? runs[c->run].offset : pos);
+}
+
+/**
+ * cursor_limb - read a limb of a sparse_u4b.
+ * @c: the cursor, moved forward to the run holding the limb
+ * @pos: the position of the limb, not before any earlier position
+ *
+ * Return: the limb, 0 if it is in a gap.
+ */
+uint32_t cursor_limb(run_cursor *c, size_t pos)
+{
+	const limb_run *run = NULL;
+
+	if (cursor_next(c, pos) != pos)
+		return (0);
+
+	run = &c->n->runs[c->run];
+	return (c->n->limbs[c->limb + pos - run->offset]);
+}
+
+/**
+ * cmp_magnitudes - compare the magnitudes of 2 sparse_u4bs.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Description: the most significant differing limb decides, it is the last
+ * one met walking up the stored limbs of both numbers.
+ *
+ * Return: +ve number if |n1| > |n2|, -ve number if |n1| < |n2| else 0.
+ */
+ssize_t cmp_magnitudes(const sparse_u4b *n1, const sparse_u4b *n2)
+{
+	run_cursor c1 = {.n = n1}, c2 = {.n = n2};
+	size_t pos = 0, pos2 = 0;
+	uint32_t limb1 = 0, limb2 = 0;
+	ssize_t cmp = 0;
+
+	if (n1->len != n2->len)
+		return ((ssize_t)n1->len - n2->len);
+
+	for (;; pos++)
+	{
+		pos2 = cursor_next(&c2, pos);
+		pos = cursor_next(&c1, pos);
+		if (pos2 < pos)
+			pos = pos2;
+
+		if (pos == SIZE_MAX)
+			break;
+
+		limb1 = cursor_limb(&c1, pos);
+		limb2 = cursor_limb(&c2, pos);
+		if (limb1 != limb2)
+			cmp = limb1 > limb2 ? 1 : -1;
+	}
+
+	return (cmp);
+}
+
+/**
+ * add_magnitudes - add the magnitudes of 2 sparse_u4bs.
+ * @r: a zero sparse_u4b to store the sum in
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Description: only the stored limbs of n1 and n2 are visited, plus the limb
+ * after each of them when a carry comes out of it.
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int add_magnitudes(sparse_u4b *r, const sparse_u4b *n1, const sparse_u4b *n2)
+{
+	run_cursor c1 = {.n = n1}, c2 = {.n = n2};
+	size_t pos = 0, pos2 = 0;
+	uint32_t carry = 0, sum = 0;
+
+	for (;; pos++)
+	{
+		if (!carry)
+		{
+			pos2 = cursor_next(&c2, pos);
+			pos = cursor_next(&c1, pos);
+			if (pos2 < pos)
+				pos = pos2;
+
+			if (pos == SIZE_MAX)
+				break;
+		}
+
+		sum = cursor_limb(&c1, pos) + cursor_limb(&c2, pos) + carry;
+		carry = (sum >= MAX_VAL_u4b);
+		if (push_limb(r, pos, carry ? sum - MAX_VAL_u4b : sum))
+			return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * sub_magnitudes - subtract the magnitudes of 2 sparse_u4bs.
+ * @r: a zero sparse_u4b to store the difference in
+ * @n1: the first number, |n1| >= |n2|
+ * @n2: the second number
+ *
+ * Description: a borrow turns the zero limbs it crosses into 999,999,999, so
+ * the difference can have far more stored limbs than n1 and n2.
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int sub_magnitudes(sparse_u4b *r, const sparse_u4b *n1, const sparse_u4b *n2)
+{
+	run_cursor c1 = {.n = n1}, c2 = {.n = n2};
+	size_t pos = 0, pos2 = 0;
+	uint32_t borrow = 0, sub = 0, limb = 0;
+
+	for (;; pos++)
+	{
+		if (!borrow)
+		{
+			pos2 = cursor_next(&c2, pos);
+			pos = cursor_next(&c1, pos);
+			if (pos2 < pos)
+				pos = pos2;
+
+			if (pos == SIZE_MAX)
+				break;
+		}
+
+		limb = cursor_limb(&c1, pos);
+		sub = cursor_limb(&c2, pos) + borrow;
+		borrow = (limb < sub);
+		if (push_limb(r, pos, borrow ? limb + MAX_VAL_u4b - sub : limb - sub))
+			return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * add_signed - add or subtract 2 sparse_u4bs.
+ * @n1: the first number
+ * @n2: the second number
+ * @negate2: 1 to subtract n2 instead of adding it
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+sparse_u4b *add_signed(const sparse_u4b *n1, const sparse_u4b *n2, char negate2)
+{
+	sparse_u4b *result = alloc_sparse_u4b();
+	char neg1 = n1->is_negative, neg2 = (n2->is_negative != 0) != (negate2 != 0);
+	int err = 0;
+
+	if (!result)
+		return (NULL);
+
+	if (neg1 == neg2)
+	{
+		err = add_magnitudes(result, n1, n2);
+		result->is_negative = neg1;
+	}
+	else if (cmp_magnitudes(n1, n2) >= 0)
+	{
+		err = sub_magnitudes(result, n1, n2);
+		result->is_negative = neg1;
+	}
+	else
+	{
+		err = sub_magnitudes(result, n2, n1);
+		result->is_negative = neg2;
+	}
+
+	if (err)
+		return (free_sparse_u4b(result));
+
+	if (!result->nruns)
+		result->is_negative = 0;
+
+	return (result);
+}
+
+/**
+ * sparse_from_u4b - compress a u4b_array into runs.
+ * @arr: the number
+ *
+ * Return: the compressed number (free with free_sparse_u4b()), NULL on
+ * failure.
+ */
+sparse_u4b *sparse_from_u4b(const u4b_array *arr)
+{
+	sparse_u4b *n = NULL;
+	size_t i = 0;
+
+	if (!arr)
+		return (NULL);
+
+	n = alloc_sparse_u4b();
+	if (!n)
+		return (NULL);
+
+	for (i = 0; arr->array && i < arr->len; i++)
+	{
+		if (push_limb(n, i, arr->array[i]))
+			return (free_sparse_u4b(n));
+	}
+
+	n->is_negative = n->nruns ? (arr->is_negative != 0) : 0;
+	return (n);
+}
+
+/**
+ * sparse_to_u4b - expand a sparse_u4b into a u4b_array.
+ * @n: the number
+ *
+ * Return: pointer to a normalized u4b_array, NULL on failure
+ */
+u4b_array *sparse_to_u4b(const sparse_u4b *n)
+{
+	u4b_array *arr = NULL;
+	size_t r = 0, limb = 0;
+
+	if (!n)
+		return (NULL);
+
+	arr = alloc_u4b_array(n->len ? n->len : 1);
+	if (!arr)
+		return (NULL);
+
+	for (r = 0; r < n->nruns; r++)
+	{
+		memcpy(&arr->array[n->runs[r].offset], &n->limbs[limb],
+			   sizeof(*n->limbs) * n->runs[r].len);
+		limb += n->runs[r].len;
+	}
+
+	arr->is_negative = n->is_negative;
+	trim_u4b_array(arr);
+	ASSERT_NORMALIZED(arr);
+	return (arr);
+}
+
+/**
+ * free_sparse_u4b - free a sparse_u4b.
+ * @n: the number, may be NULL
+ *
+ * Return: NULL always.
+ */
+void *free_sparse_u4b(sparse_u4b *n)
+{
+	if (!n)
+		return (NULL);
+
+	n->runs = free_n_null(n->runs);
+	n->limbs = free_n_null(n->limbs);
+	return (free_n_null(n));
+}
+
+/**
+ * cmp_sparse_u4b - compare 2 sparse_u4bs.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Return: +ve number if n1 > n2, -ve number if n1 < n2 else 0.
+ */
+ssize_t cmp_sparse_u4b(const sparse_u4b *n1, const sparse_u4b *n2)
+{
+	if (!n1 || !n2)
+		return (0);
+
+	if (n1->is_negative != n2->is_negative)
+		return (n1->is_negative ? -1 : 1);
+
+	if (n1->is_negative)
+		return (cmp_magnitudes(n2, n1));
+
+	return (cmp_magnitudes(n1, n2));
+}
+
+/**
+ * sparse_addition - add 2 sparse_u4bs without expanding them.
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Description: the work is proportional to the stored limbs of n1 and n2,
+ * not to their length.
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+sparse_u4b *sparse_addition(const sparse_u4b *n1, const sparse_u4b *n2)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (add_signed(n1, n2, 0));
+}
+
+/**
+ * sparse_subtraction - subtract 2 sparse_u4bs without expanding them.
+ * @n1: the first number
+ * @n2: the number to subtract
+ *
+ * Description: see sparse_addition().
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+sparse_u4b *sparse_subtraction(const sparse_u4b *n1, const sparse_u4b *n2)
+{
+	if (!n1 || !n2)
+		return (NULL);
+
+	return (add_signed(n1, n2, 1));
+}
+
+/**
+ * sparse_dense_op - apply a u4b_array function to 2 sparse_u4bs.
+ * @f: the function, e.g. infiX_multiplication
+ * @n1: the first number
+ * @n2: the second number
+ *
+ * Description: for operations that have no sparse version, n1 and n2 are
+ * expanded, f is applied and its result compressed again.
+ *
+ * Return: pointer to the result, NULL on failure
+ */
+sparse_u4b *sparse_dense_op(math_function *f, const sparse_u4b *n1, const sparse_u4b *n2)
+{
+	u4b_array *a1 = NULL, *a2 = NULL, *result = NULL;
+	sparse_u4b *sparse = NULL;
+
+	if (!f || !n1 || !n2)
+		return (NULL);
+
+	a1 = sparse_to_u4b(n1);
+	a2 = sparse_to_u4b(n2);
+	if (a1 && a2)
+		result = f(a1, a2);
+
+	if (result)
+		sparse = sparse_from_u4b(result);
+
+	a1 = free_u4b_array(a1);
+	a2 = free_u4b_array(a2);
+	result = free_u4b_array(result);
+	return (sparse);
+}
@@ -21,11 +21,35 @@ size_t padding_chars_len(char *str, char *ch)
 	return (count);
 }
 
+/**
+ * misplaced_underscore - check that underscores only separate digits.
+ * @str: the string to check
+ * @len: number of characters of str to check
+ *
+ * Description: "1_000" is fine, "_1", "1_", "1__0" and "1,_0" are not.
+ *
+ * Return: 1 if an underscore is not between two digits, else 0
+ */
+int misplaced_underscore(const char *str, size_t len)
+{
+	size_t i = 0;
+
+	for (i = 0; str && i < len; i++)
+	{
+		if (str[i] == '_' &&
+			(!i || i + 1 >= len || !isdigit((unsigned char)str[i - 1]) ||
+			 !isdigit((unsigned char)str[i + 1])))
+			return (1);
+	}
+
+	return (0);
+}
+
 /**
  * print_u4b_array - print a u4b_array
  * @arr: pointer to the array struct
  */
-void print_u4b_array(u4b_array *arr)
+void print_u4b_array(const u4b_array *arr)
 {
 	size_t i = 0;
 
@@ -384,3 +384,69 @@ Test(negative_numbers, test_minus1_cmp_1,
 
 	cr_assert(lt(long, cmp_u4barray(&num1, &num2), 0));
 }
+
+TestSuite(views, .init = setup, .fini = teardown);
+
+Test(views, test_slice_cmp_equal_array,
+	 .description = "compare(slice(3,2,1 at 1 len 2), 2,1) == 0", .timeout = 2.0)
+{
+	uint32_t in1[] = {1, 2, 3};
+	uint32_t in2[] = {2, 3};
+	u4b_array view = {0};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+	view = slice_u4b_array(&num1, 1, 2);
+
+	cr_assert(eq(long, view.capacity, 0));
+	cr_assert(zero(long, cmp_u4barray(&view, &num2)));
+}
+
+Test(views, test_slice_is_clamped,
+	 .description = "slice(3,2,1 at 2 len 5) has 1 limb", .timeout = 2.0)
+{
+	uint32_t in1[] = {1, 2, 3};
+	u4b_array view = {0};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+	view = slice_u4b_array(&num1, 2, 5);
+
+	cr_assert(eq(long, view.len, 1));
+	cr_assert(eq(long, view.is_negative, 1));
+	cr_assert(eq(long, view.array[0], 3));
+}
+
+TestSuite(normalized, .init = setup, .fini = teardown);
+
+Test(normalized, test_leading_zeros_not_normalized,
+	 .description = "0,0,1 is not normalized until trimmed", .timeout = 2.0)
+{
+	uint32_t in1[] = {1, 0, 0};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+
+	cr_assert(zero(long, is_normalized_u4b_array(&num1)));
+	trim_u4b_array(&num1);
+	cr_assert(is_normalized_u4b_array(&num1));
+	cr_assert(eq(long, num1.len, 1));
+}
+
+Test(normalized, test_minus0_not_normalized,
+	 .description = "-0 is not normalized until trimmed", .timeout = 2.0)
+{
+	uint32_t in1[] = {0};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+
+	cr_assert(zero(long, is_normalized_u4b_array(&num1)));
+	trim_u4b_array(&num1);
+	cr_assert(is_normalized_u4b_array(&num1));
+	cr_assert(zero(long, num1.is_negative));
+}
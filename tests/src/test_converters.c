@@ -0,0 +1,96 @@
+#include "tests.h"
+
+u4b_array *num = NULL;
+char *output = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	num = free_u4b_array(num);
+	output = free_n_null(output);
+}
+
+TestSuite(number_strings, .init = setup, .fini = teardown);
+
+Test(number_strings, test_underscores,
+	 .description = "-1_000_000_007 = -1000000007", .timeout = 2.0)
+{
+	num = str_to_intarray("-1_000_000_007");
+	cr_assert(num);
+	output = intarr_to_str(num);
+	cr_expect(eq(str, output, "-1000000007"));
+}
+
+Test(number_strings, test_exponent,
+	 .description = "-1_000E+12 = -10^15, 25e7 = 250000000, 0e99 = 0",
+	 .timeout = 2.0)
+{
+	num = str_to_intarray("-1_000E+12");
+	cr_assert(num);
+	output = intarr_to_str(num);
+	cr_expect(eq(str, output, "-1000000000000000"));
+	output = free_n_null(output);
+	num = free_u4b_array(num);
+	num = str_to_intarray("25e7");
+	cr_assert(num);
+	cr_expect(eq(sz, num->len, 1));
+	cr_expect(eq(u32, num->array[0], 250000000));
+	num = free_u4b_array(num);
+	num = str_to_intarray("0e99");
+	cr_assert(num);
+	output = intarr_to_str(num);
+	cr_expect(eq(str, output, "0"));
+}
+
+Test(number_strings, test_huge_exponent,
+	 .description = "3e50000000 has 5555556 limbs, all zero but the top",
+	 .timeout = 2.0)
+{
+	size_t i = 0;
+
+	num = str_to_intarray("3e50000000");
+	cr_assert(num);
+	cr_assert(eq(sz, num->len, 5555556));
+	cr_expect(eq(u32, num->array[num->len - 1], 300000));
+	for (i = 0; i < num->len - 1 && !num->array[i]; i++)
+		;
+
+	cr_expect(eq(sz, i, num->len - 1));
+}
+
+Test(number_strings, test_bad_exponent,
+	 .description = "7e-3, 7e and 7e1x are not whole numbers", .timeout = 2.0)
+{
+	cr_expect(zero(ptr, str_to_intarray("7e-3")));
+	cr_expect(zero(ptr, str_to_intarray("7e")));
+	cr_expect(zero(ptr, str_to_intarray("7e1x")));
+}
+
+Test(number_strings, test_no_mantissa,
+	 .description = "e5 and -e5 have no digits before the exponent",
+	 .timeout = 2.0)
+{
+	cr_expect(zero(ptr, str_to_intarray("e5")));
+	cr_expect(zero(ptr, str_to_intarray("-e5")));
+}
+
+Test(number_strings, test_misplaced_underscores,
+	 .description = "1e5_, _1_, 1__0 and 1e_5 have stray underscores",
+	 .timeout = 2.0)
+{
+	cr_expect(zero(ptr, str_to_intarray("1e5_")));
+	cr_expect(zero(ptr, str_to_intarray("_1_")));
+	cr_expect(zero(ptr, str_to_intarray("1__0")));
+	cr_expect(zero(ptr, str_to_intarray("1e_5")));
+	num = str_to_intarray("1_000e1_2");
+	cr_assert(num);
+	output = intarr_to_str(num);
+	cr_expect(eq(str, output, "1000000000000000"));
+}
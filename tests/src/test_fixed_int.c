@@ -0,0 +1,100 @@
+#include "tests.h"
+
+u4b_array *output = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	output = free_u4b_array(output);
+}
+
+TestSuite(fixed256, .init = setup, .fini = teardown);
+
+Test(fixed256, test_add_wraps,
+	 .description = "(2^256 - 1) + 1 = 0 and 0 - 1 = 2^256 - 1", .timeout = 2.0)
+{
+	fixed256 max = {.limbs = {129639935, 584007913, 564039457, 984665640,
+							  907853269, 985008687, 195423570, 89237316, 115792}};
+	fixed256 a = max, b = {.limbs = {1}}, zero = {0};
+
+	cr_expect(eq(u32, fixed256_add(&a, &a, &b), 1));
+	cr_expect(eq(u32[FIXED256_LIMBS], a.limbs, zero.limbs));
+	cr_expect(eq(u32, fixed256_sub(&a, &a, &b), 1));
+	cr_expect(eq(u32[FIXED256_LIMBS], a.limbs, max.limbs));
+	cr_expect(zero(u32, fixed256_sub(&a, &a, &b)));
+	cr_expect(zero(u32, fixed256_add(&a, &a, &b)));
+	cr_expect(eq(u32[FIXED256_LIMBS], a.limbs, max.limbs));
+}
+
+Test(fixed256, test_mul_overflow,
+	 .description = "10^36 * 10^36 fits, 10^45 * 10^36 and 2^128 * 2^128 do not",
+	 .timeout = 2.0)
+{
+	fixed256 a = {0}, b = {0}, r = {0};
+	fixed256 half = {.limbs = {768211456, 374607431, 938463463, 282366920, 340}};
+
+	a.limbs[4] = 1;
+	b.limbs[4] = 1;
+	cr_expect(zero(int, fixed256_mul(&r, &a, &b)));
+	cr_expect(eq(u32, r.limbs[8], 1));
+	a.limbs[4] = 0;
+	a.limbs[5] = 1;
+	cr_expect(eq(int, fixed256_mul(&r, &a, &b), -1));
+	cr_expect(eq(int, fixed256_mul(&r, &half, &half), -1));
+}
+
+Test(fixed256, test_mod,
+	 .description = "(10^72 + 5) % (10^9 + 7) and % 0", .timeout = 2.0)
+{
+	fixed256 a = {.limbs = {5, 0, 0, 0, 0, 0, 0, 0, 1}}, m = {.limbs = {7, 1}};
+	fixed256 r = {0}, zero = {0};
+	uint32_t out[FIXED256_LIMBS] = {5764806};
+
+	cr_expect(zero(int, fixed256_mod(&r, &a, &m)));
+	cr_expect(eq(u32[FIXED256_LIMBS], r.limbs, out));
+	cr_expect(eq(int, fixed256_mod(&r, &a, &zero), -1));
+}
+
+TestSuite(conversions, .init = setup, .fini = teardown);
+
+Test(conversions, test_round_trip,
+	 .description = "u4b_array -> fixed2048 -> u4b_array", .timeout = 2.0)
+{
+	uint32_t in1[] = {5, 0, 123456789, 0, 0};
+	u4b_array num1 = {.len = 5, .is_negative = 0, .array = in1};
+	fixed2048 n = {0};
+
+	cr_assert(zero(int, fixed2048_from_u4b(&n, &num1)));
+	output = fixed2048_to_u4b(&n);
+	cr_assert(output);
+	cr_expect(eq(sz, output->len, 3));
+	cr_expect(eq(u32[3], output->array, in1));
+}
+
+Test(conversions, test_rejects,
+	 .description = "negative arrays and 2^256 or more are rejected",
+	 .timeout = 2.0)
+{
+	uint32_t in1[FIXED256_LIMBS + 1] = {1, [FIXED256_LIMBS] = 1};
+	uint32_t limit[FIXED256_LIMBS] = {129639936, 584007913, 564039457,
+									  984665640, 907853269, 985008687,
+									  195423570, 89237316, 115792};
+	u4b_array num1 = {.len = FIXED256_LIMBS + 1, .is_negative = 0, .array = in1};
+	u4b_array num2 = {.len = FIXED256_LIMBS, .is_negative = 0, .array = limit};
+	fixed256 n = {0};
+
+	cr_expect(eq(int, fixed256_from_u4b(&n, &num1), -1));
+	cr_expect(eq(int, fixed256_from_u4b(&n, &num2), -1));
+	limit[0]--;
+	cr_expect(zero(int, fixed256_from_u4b(&n, &num2)));
+	num1.len = 1;
+	num1.is_negative = 1;
+	cr_expect(eq(int, fixed256_from_u4b(&n, &num1), -1));
+}
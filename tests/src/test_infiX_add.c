@@ -5,14 +5,16 @@ u4b_array num2 = {.len = 0, .is_negative = 0, .array = NULL};
 u4b_array expected = {.len = 0, .is_negative = 0, .array = NULL};
 
 /**
- * infiX_subtraction - dummy
+ * infiX_subtraction_into - dummy
+ * @dest: unused
  * @n1: unused
  * @n2: unused
  *
  * Return: a 0 length array, NULL on failure.
  */
-u4b_array *infiX_subtraction(u4b_array *n1, u4b_array *n2)
+u4b_array *infiX_subtraction_into(u4b_array *dest, const u4b_array *n1, const u4b_array *n2)
 {
+	(void)dest;
 	(void)n1;
 	(void)n2;
 	return (alloc_u4b_array(0));
@@ -345,6 +347,31 @@ Test(negative_additions, test_minus1_plus_1,
 	free_u4b_array(output);
 }
 
+Test(negative_additions, test_inputs_unchanged,
+	 .description = "-0,0,1 + -0,1 = -2 leaves both operands untouched",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {1, 0, 0}, in2[] = {1, 0};
+	uint32_t out[] = {2};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.is_negative = 1;
+	num2.array = in2;
+	u4b_array *output = infiX_addition(&num1, &num2);
+
+	cr_expect(eq(sz, num1.len, 3));
+	cr_expect(eq(chr, num1.is_negative, 1));
+	cr_expect(eq(sz, num2.len, 2));
+	cr_expect(eq(chr, num2.is_negative, 1));
+	cr_expect(eq(sz, output->len, 1));
+	cr_expect(eq(chr, output->is_negative, 1));
+	cr_expect(eq(u32[1], output->array, out));
+	output = free_u4b_array(output);
+}
+
 TestSuite(large_additions, .init = setup, .fini = teardown);
 
 Test(large_additions, test_largenum1_plus_largenum2,
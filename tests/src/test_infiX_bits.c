@@ -0,0 +1,123 @@
+#include "tests.h"
+
+u4b_array *num1 = NULL, *num2 = NULL, *output = NULL;
+infiX_bits *bits = NULL, *result = NULL;
+char *output_str = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	num1 = free_u4b_array(num1);
+	num2 = free_u4b_array(num2);
+	output = free_u4b_array(output);
+	bits = free_infiX_bits(bits);
+	result = free_infiX_bits(result);
+	output_str = free_n_null(output_str);
+	free_radix_powers();
+}
+
+TestSuite(bitwise, .init = setup, .fini = teardown);
+
+Test(bitwise, test_and_or_xor_negatives,
+	 .description = "-1 & 2^70 + 5 = 2^70 + 5, -12 | 10 = -2, -12 ^ 10 = -2",
+	 .timeout = 2.0)
+{
+	num1 = str_to_intarray("-1");
+	num2 = str_to_intarray("1180591620717411303429");
+	cr_assert(num1 && num2);
+	output = infiX_and(num1, num2);
+	output_str = intarr_to_str(output);
+	cr_expect(eq(str, output_str, "1180591620717411303429"));
+	output = free_u4b_array(output);
+	output_str = free_n_null(output_str);
+	num1 = free_u4b_array(num1);
+	num2 = free_u4b_array(num2);
+	num1 = str_to_intarray("-12");
+	num2 = str_to_intarray("10");
+	output = infiX_or(num1, num2);
+	output_str = intarr_to_str(output);
+	cr_expect(eq(str, output_str, "-2"));
+	output = free_u4b_array(output);
+	output_str = free_n_null(output_str);
+	output = infiX_xor(num1, num2);
+	output_str = intarr_to_str(output);
+	cr_expect(eq(str, output_str, "-2"));
+}
+
+Test(bitwise, test_not,
+	 .description = "~(2^64 - 1) = -2^64, ~-2^64 = 2^64 - 1, ~0 = -1",
+	 .timeout = 2.0)
+{
+	num1 = str_to_intarray("18446744073709551615");
+	cr_assert(num1);
+	output = infiX_not(num1, NULL);
+	output_str = intarr_to_str(output);
+	cr_expect(eq(str, output_str, "-18446744073709551616"));
+	output_str = free_n_null(output_str);
+	num2 = infiX_not(output, NULL);
+	cr_expect(zero(long, cmp_u4barray(num1, num2)));
+	num1 = free_u4b_array(num1);
+	output = free_u4b_array(output);
+	num1 = alloc_u4b_array(1);
+	output = infiX_not(num1, NULL);
+	output_str = intarr_to_str(output);
+	cr_expect(eq(str, output_str, "-1"));
+}
+
+Test(bitwise, test_shifts,
+	 .description = "1 << 100 = 2^100, -5 >> 1 = -3, -5 >> 1000 = -1",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {1}, in2[] = {100}, in3[] = {5}, in4[] = {1000};
+	u4b_array one = {1, 0, 0, in1}, hundred = {1, 0, 0, in2};
+	u4b_array five = {1, 0, 1, in3}, thousand = {1, 0, 0, in4};
+
+	output = infiX_lshift(&one, &hundred);
+	output_str = intarr_to_str(output);
+	cr_expect(eq(str, output_str, "1267650600228229401496703205376"));
+	output = free_u4b_array(output);
+	output_str = free_n_null(output_str);
+	output = infiX_rshift(&five, &one);
+	output_str = intarr_to_str(output);
+	cr_expect(eq(str, output_str, "-3"));
+	output = free_u4b_array(output);
+	output_str = free_n_null(output_str);
+	output = infiX_rshift(&five, &thousand);
+	output_str = intarr_to_str(output);
+	cr_expect(eq(str, output_str, "-1"));
+	cr_expect(zero(ptr, infiX_lshift(&one, &five)));
+}
+
+Test(bitwise, test_binary_form,
+	 .description = "(2^64 + 3) << 31 >> 95 & 1 in binary form is 1",
+	 .timeout = 2.0)
+{
+	infiX_bits mask = {1, 0, NULL};
+	uint32_t one[] = {1};
+
+	num1 = str_to_intarray("18446744073709551619");
+	bits = bits_from_u4b(num1);
+	cr_assert(bits);
+	cr_expect(eq(sz, bits->len, 3));
+	cr_expect(eq(u32, bits->words[0], 3));
+	cr_expect(eq(u32, bits->words[2], 1));
+	result = bits_shift_left(bits, 31);
+	bits = free_infiX_bits(bits);
+	bits = bits_shift_right(result, 95);
+	result = free_infiX_bits(result);
+	mask.words = one;
+	result = bits_and(bits, &mask);
+	cr_assert(result);
+	cr_expect(eq(sz, result->len, 1));
+	cr_expect(eq(u32, result->words[0], 1));
+	output = bits_to_u4b(result);
+	output_str = intarr_to_str(output);
+	cr_expect(eq(str, output_str, "1"));
+}
@@ -0,0 +1,92 @@
+#include "tests.h"
+
+infiX_decimal *n1 = NULL, *n2 = NULL, *result = NULL;
+char *output = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	n1 = free_infiX_decimal(n1);
+	n2 = free_infiX_decimal(n2);
+	result = free_infiX_decimal(result);
+	output = free_n_null(output);
+}
+
+TestSuite(decimal_strings, .init = setup, .fini = teardown);
+
+Test(decimal_strings, test_round_trip,
+	 .description = "-0.0150 keeps its scale", .timeout = 2.0)
+{
+	n1 = decimal_from_str("-0.0150");
+	cr_assert(n1);
+	cr_expect(eq(sz, n1->scale, 4));
+	cr_expect(eq(u32, n1->mantissa->array[0], 150));
+	output = decimal_to_str(n1);
+	cr_assert(output);
+	cr_expect(eq(str, output, "-0.0150"));
+}
+
+Test(decimal_strings, test_exponent,
+	 .description = "1.5e3 is 1500.0", .timeout = 2.0)
+{
+	n1 = decimal_from_str("1.5e3");
+	cr_assert(n1);
+	cr_expect(eq(sz, n1->scale, 1));
+	output = decimal_to_str(n1);
+	cr_assert(output);
+	cr_expect(eq(str, output, "1500.0"));
+}
+
+TestSuite(decimal_ops, .init = setup, .fini = teardown);
+
+Test(decimal_ops, test_add_sub_truncate,
+	 .description = "1.25 + -3.5 = -2.2 and 1.25 - -3.5 = 4.75", .timeout = 2.0)
+{
+	n1 = decimal_from_str("1.25");
+	n2 = decimal_from_str("-3.5");
+	result = decimal_addition(n1, n2, 1);
+	output = decimal_to_str(result);
+	cr_assert(output);
+	cr_expect(eq(str, output, "-2.2"));
+	output = free_n_null(output);
+	result = free_infiX_decimal(result);
+	result = decimal_subtraction(n1, n2, 3);
+	output = decimal_to_str(result);
+	cr_assert(output);
+	cr_expect(eq(str, output, "4.750"));
+}
+
+Test(decimal_ops, test_short_product,
+	 .description = "0.(100 nines)^2 to 50 places is 0.(50 nines)", .timeout = 2.0)
+{
+	char nines[103] = "0.", expected[53] = "0.";
+
+	memset(&nines[2], '9', 100);
+	memset(&expected[2], '9', 50);
+	n1 = decimal_from_str(nines);
+	result = decimal_multiplication(n1, n1, 50);
+	output = decimal_to_str(result);
+	cr_assert(output);
+	cr_expect(eq(str, output, expected));
+}
+
+Test(decimal_ops, test_division,
+	 .description = "-1 / 3 = -0.333333 and 1 / 0 fails", .timeout = 2.0)
+{
+	n1 = decimal_from_str("-1");
+	n2 = decimal_from_str("3.0");
+	result = decimal_division(n1, n2, 6);
+	output = decimal_to_str(result);
+	cr_assert(output);
+	cr_expect(eq(str, output, "-0.333333"));
+	n2 = free_infiX_decimal(n2);
+	n2 = decimal_from_str("0.00");
+	cr_expect(zero(ptr, decimal_division(n1, n2, 6)));
+}
@@ -0,0 +1,97 @@
+#include "tests.h"
+
+u4b_array *num = NULL;
+char *output = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	num = free_u4b_array(num);
+	output = free_n_null(output);
+}
+
+TestSuite(digit_queries, .init = setup, .fini = teardown);
+
+Test(digit_queries, test_digit_count,
+	 .description = "digits of 0, -999999999, 1000000000 and 10^27",
+	 .timeout = 2.0)
+{
+	uint32_t zero[] = {0, 0}, nines[] = {999999999}, big[] = {0, 1};
+	uint32_t huge[] = {0, 0, 0, 1};
+	u4b_array n0 = {2, 0, 0, zero}, n1 = {1, 0, 1, nines}, n2 = {2, 0, 0, big};
+	u4b_array n3 = {4, 0, 0, huge};
+
+	cr_expect(eq(sz, intarr_digit_count(&n0), 1));
+	cr_expect(eq(sz, intarr_digit_count(&n1), 9));
+	cr_expect(eq(sz, intarr_digit_count(&n2), 10));
+	cr_expect(eq(sz, intarr_digit_count(&n3), 28));
+}
+
+Test(digit_queries, test_first_and_last_digits,
+	 .description = "-1234567890000000007: first 12, last 3 and last 40",
+	 .timeout = 2.0)
+{
+	num = str_to_intarray("-1234567890000000007");
+	cr_assert(num);
+	output = intarr_first_digits(num, 12);
+	cr_expect(eq(str, output, "-123456789000"));
+	output = free_n_null(output);
+	output = intarr_last_digits(num, 3);
+	cr_expect(eq(str, output, "-007"));
+	output = free_n_null(output);
+	output = intarr_last_digits(num, 40);
+	cr_expect(eq(str, output, "-1234567890000000007"));
+	output = free_n_null(output);
+	output = intarr_first_digits(num, 0);
+	cr_expect(eq(str, output, ""));
+}
+
+Test(digit_queries, test_scientific,
+	 .description = "-123456 is -1.23e+5, 9999999999 is 1.000e+10",
+	 .timeout = 2.0)
+{
+	num = str_to_intarray("-123456");
+	cr_assert(num);
+	output = intarr_to_sci_str(num, 2);
+	cr_expect(eq(str, output, "-1.23e+5"));
+	output = free_n_null(output);
+	output = intarr_to_sci_str(num, 8);
+	cr_expect(eq(str, output, "-1.23456000e+5"));
+	output = free_n_null(output);
+	num = free_u4b_array(num);
+	num = str_to_intarray("9999999999");
+	cr_assert(num);
+	output = intarr_to_sci_str(num, 3);
+	cr_expect(eq(str, output, "1.000e+10"));
+	output = free_n_null(output);
+	output = intarr_to_sci_str(num, 0);
+	cr_expect(eq(str, output, "1e+10"));
+}
+
+Test(digit_queries, test_format,
+	 .description = "format_intarr() for each output mode", .timeout = 2.0)
+{
+	output_format full = {OUTPUT_FULL, 0}, count = {OUTPUT_DIGIT_COUNT, 0};
+	output_format last = {OUTPUT_LAST_DIGITS, 4}, sci = {OUTPUT_SCIENTIFIC, 1};
+
+	num = str_to_intarray("31415926535");
+	cr_assert(num);
+	output = format_intarr(num, &full);
+	cr_expect(eq(str, output, "31415926535"));
+	output = free_n_null(output);
+	output = format_intarr(num, &count);
+	cr_expect(eq(str, output, "11"));
+	output = free_n_null(output);
+	output = format_intarr(num, &last);
+	cr_expect(eq(str, output, "6535"));
+	output = free_n_null(output);
+	output = format_intarr(num, &sci);
+	cr_expect(eq(str, output, "3.1e+10"));
+}
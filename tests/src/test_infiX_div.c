@@ -337,6 +337,29 @@ Test(simple_divisions, test_equal_over_equal,
 	output = free_u4b_array(output);
 }
 
+Test(simple_divisions, test_divisor_with_zero_limbs,
+	 .description = "987,654,321,123,456,789,000,000,001 / 25 * 10^18 ="
+					" 39,506,172 remainder 21,123,456,789,000,000,001",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {1, 123456789, 987654321}, in2[] = {0, 0, 25};
+	uint32_t out[] = {39506172}, rem[] = {1, 123456789, 21};
+	u4b_array *quotient = NULL, *remainder = NULL;
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+
+	cr_assert(zero(int, infiX_divmod(&num1, &num2, &quotient, &remainder)));
+	cr_expect(eq(sz, quotient->len, 1));
+	cr_expect(eq(u32[1], quotient->array, out));
+	cr_expect(eq(sz, remainder->len, 3));
+	cr_expect(eq(u32[3], remainder->array, rem));
+	quotient = free_u4b_array(quotient);
+	remainder = free_u4b_array(remainder);
+}
+
 TestSuite(negative_divisions, .init = setup, .fini = teardown);
 
 Test(negative_divisions, test_minus9107428777003_over_minus809754437,
@@ -408,6 +431,119 @@ Test(negative_divisions, test_9107428777003_over_minus809754437,
 	output = free_u4b_array(output);
 }
 
+Test(negative_divisions, test_minus10_over_5,
+	 .description = "-10 / 5 = -2", .timeout = 2.0)
+{
+	uint32_t in1[] = {10}, in2[] = {5}, out[] = {2};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+	expected.len = sizeof(out) / sizeof(*out);
+	expected.is_negative = 1;
+	expected.array = out;
+
+	u4b_array *output = infiX_division(&num1, &num2);
+
+	cr_expect(eq(sz, output->len, expected.len));
+	cr_expect(eq(chr, output->is_negative, expected.is_negative));
+	cr_expect(eq(u32[expected.len], output->array, expected.array));
+	output = free_u4b_array(output);
+}
+
+TestSuite(divmod, .init = setup, .fini = teardown);
+
+Test(divmod, test_divmod_longnum1_longnum2,
+	 .description = "divmod(2,100,550,005,550,000,000,000,000,045,000,000,000,005,000,065,000,"
+					" 75,006,000,000,000)"
+					" = (28,005,092,999,893,341,865,984,055,208,916,620, 285,000,065,000)",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {65000, 000000005, 45000, 0, 550005550, 2100};
+	uint32_t in2[] = {0, 75006};
+	uint32_t out[] = {208916620, 865984055, 999893341, 28005092};
+	uint32_t rem[] = {65000, 285};
+	u4b_array *quotient = NULL, *remainder = NULL;
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+
+	cr_assert(zero(long, infiX_divmod(&num1, &num2, &quotient, &remainder)));
+	cr_expect(eq(sz, quotient->len, sizeof(out) / sizeof(*out)));
+	cr_expect(eq(u32[sizeof(out) / sizeof(*out)], quotient->array, out));
+	cr_expect(eq(sz, remainder->len, sizeof(rem) / sizeof(*rem)));
+	cr_expect(eq(u32[sizeof(rem) / sizeof(*rem)], remainder->array, rem));
+	quotient = free_u4b_array(quotient);
+	remainder = free_u4b_array(remainder);
+}
+
+Test(divmod, test_divmod_remainder_only,
+	 .description = "divmod(-9,107,428,777,003, 809,754,437) = (_, -689,130,373)",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {428777003, 9107}, in2[] = {809754437}, rem[] = {689130373};
+	u4b_array *remainder = NULL;
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+
+	cr_assert(zero(long, infiX_divmod(&num1, &num2, NULL, &remainder)));
+	cr_expect(eq(chr, num1.is_negative, 1));
+	cr_expect(eq(sz, remainder->len, 1));
+	cr_expect(eq(chr, remainder->is_negative, 1));
+	cr_expect(eq(u32[1], remainder->array, rem));
+	remainder = free_u4b_array(remainder);
+}
+
+Test(divmod, test_divmod_by_0,
+	 .description = "divmod(1, 0) fails", .timeout = 2.0)
+{
+	uint32_t in1[] = {1}, in2[] = {0};
+	u4b_array *quotient = NULL, *remainder = NULL;
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+
+	cr_expect(eq(long, infiX_divmod(&num1, &num2, &quotient, &remainder), -1));
+	cr_expect(zero(ptr, quotient));
+	cr_expect(zero(ptr, remainder));
+}
+
+Test(divmod, test_divmod_keeps_inputs,
+	 .description = "divmod(-0,0,7, -0,3) leaves both operands untouched",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {7, 0, 0}, in2[] = {3, 0}, out[] = {2}, rem[] = {1};
+	u4b_array *quotient = NULL, *remainder = NULL;
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.is_negative = 1;
+	num2.array = in2;
+
+	cr_assert(zero(long, infiX_divmod(&num1, &num2, &quotient, &remainder)));
+	cr_expect(eq(sz, num1.len, 3));
+	cr_expect(eq(chr, num1.is_negative, 1));
+	cr_expect(eq(sz, num2.len, 2));
+	cr_expect(eq(chr, num2.is_negative, 1));
+	cr_expect(eq(u32[1], quotient->array, out));
+	cr_expect(zero(chr, quotient->is_negative));
+	cr_expect(eq(u32[1], remainder->array, rem));
+	quotient = free_u4b_array(quotient);
+	remainder = free_u4b_array(remainder);
+}
+
 TestSuite(large_divisions, .init = setup, .fini = teardown);
 
 Test(large_divisions, test_largenum1_over_largenum2,
@@ -452,3 +588,109 @@ Test(large_divisions, test_medium_largenum1_over_medium_largenum2,
 	cr_expect(eq(u32[expected.len], output->array, expected.array));
 	output = free_u4b_array(output);
 }
+
+TestSuite(prepared_divisor, .init = setup, .fini = teardown);
+
+Test(prepared_divisor, test_reused_divisor,
+	 .description = "one divisor of -75,006,000,000,000 for two numerators",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {65000, 5, 45000, 0, 550005550, 2100};
+	uint32_t in2[] = {0, 75006}, in3[] = {428777003, 9107};
+	uint32_t out[] = {208916621, 865984055, 999893341, 28005092};
+	uint32_t rem[] = {999935000, 74720};
+	u4b_array *quotient = NULL, *remainder = NULL;
+	infiX_divisor *d = NULL;
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.is_negative = 1;
+	num2.array = in2;
+	d = infiX_divisor_new(&num2);
+	cr_assert(d);
+
+	cr_assert(zero(int, infiX_divmod_by(&num1, d, &quotient, &remainder)));
+	cr_expect(eq(sz, quotient->len, 4));
+	cr_expect(eq(chr, quotient->is_negative, 1));
+	cr_expect(eq(u32[4], quotient->array, out));
+	cr_expect(eq(sz, remainder->len, 2));
+	cr_expect(eq(chr, remainder->is_negative, 1));
+	cr_expect(eq(u32[2], remainder->array, rem));
+	quotient = free_u4b_array(quotient);
+	remainder = free_u4b_array(remainder);
+
+	num1.len = sizeof(in3) / sizeof(*in3);
+	num1.is_negative = 1;
+	num1.array = in3;
+	remainder = infiX_modulus_by(&num1, d);
+	cr_assert(remainder);
+	cr_expect(zero(chr, remainder->is_negative));
+	cr_expect(eq(u32[2], remainder->array, in3));
+	remainder = free_u4b_array(remainder);
+	d = free_infiX_divisor(d);
+}
+
+Test(prepared_divisor, test_zero_divisor,
+	 .description = "0 can not be prepared", .timeout = 2.0)
+{
+	uint32_t in2[] = {0, 0};
+
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+	cr_expect(zero(ptr, infiX_divisor_new(&num2)));
+	cr_expect(zero(ptr, infiX_divisor_new(NULL)));
+	cr_expect(zero(ptr, infiX_division_by(&num2, NULL)));
+}
+
+TestSuite(exact_divisions, .init = setup, .fini = teardown);
+
+Test(exact_divisions, test_divisor_ending_in_zeros,
+	 .description = "30,864,197,253,086,419,725,250,000,000,000 / 250,000,000,000 ="
+					" 123,456,789,012,345,678,901",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {0, 419725250, 197253086, 30864}, in2[] = {0, 250};
+	uint32_t out[] = {345678901, 456789012, 123};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+	expected.len = sizeof(out) / sizeof(*out);
+	expected.array = out;
+
+	u4b_array *output = infiX_divexact(&num1, &num2);
+
+	cr_assert(output);
+	cr_expect(eq(sz, output->len, expected.len));
+	cr_expect(zero(chr, output->is_negative));
+	cr_expect(eq(u32[expected.len], output->array, expected.array));
+	output = free_u4b_array(output);
+}
+
+Test(exact_divisions, test_negative_power_of_5_divisor,
+	 .description = "-5,787,037,042,896,412,037,109,375 / 5,859,375 ="
+					" -987,654,321,987,654,321",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {37109375, 42896412, 5787037}, in2[] = {5859375};
+	uint32_t out[] = {987654321, 987654321};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+	expected.len = sizeof(out) / sizeof(*out);
+	expected.is_negative = 1;
+	expected.array = out;
+
+	u4b_array *output = infiX_divexact(&num1, &num2);
+
+	cr_assert(output);
+	cr_expect(eq(sz, output->len, expected.len));
+	cr_expect(eq(chr, output->is_negative, expected.is_negative));
+	cr_expect(eq(u32[expected.len], output->array, expected.array));
+	output = free_u4b_array(output);
+}
@@ -0,0 +1,117 @@
+#include "tests.h"
+
+infiX_decimal *decimal = NULL;
+infiX_float *n1 = NULL, *n2 = NULL, *result = NULL;
+char *output = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	decimal = free_infiX_decimal(decimal);
+	n1 = free_infiX_float(n1);
+	n2 = free_infiX_float(n2);
+	result = free_infiX_float(result);
+	output = free_n_null(output);
+}
+
+/**
+ * float_from_str - make a float from a decimal string for a test.
+ * @num_str: the number
+ * @precision: most limbs of the float
+ *
+ * Return: the float, NULL on failure
+ */
+infiX_float *float_from_str(const char *num_str, size_t precision)
+{
+	infiX_decimal *d = decimal_from_str(num_str);
+	infiX_float *n = float_from_decimal(d, precision);
+
+	d = free_infiX_decimal(d);
+	return (n);
+}
+
+/**
+ * float_str - convert the result to a string for a test.
+ *
+ * Return: the string, NULL on failure
+ */
+char *float_str(void)
+{
+	decimal = free_infiX_decimal(decimal);
+	decimal = float_to_decimal(result);
+	return (decimal_to_str(decimal));
+}
+
+TestSuite(float_conversions, .init = setup, .fini = teardown);
+
+Test(float_conversions, test_exponent_and_truncation,
+	 .description = "-1.5 is -500000000 * B^-1, 1234567890123 to 1 limb",
+	 .timeout = 2.0)
+{
+	n1 = float_from_str("-1.5", 0);
+	cr_assert(n1);
+	cr_expect(eq(sz, n1->mantissa->len, 2));
+	cr_expect(eq(u32, n1->mantissa->array[0], 500000000));
+	cr_expect(eq(chr, n1->mantissa->is_negative, 1));
+	cr_expect(eq(i64, n1->exponent, -1));
+	n2 = float_from_str("1234567890123", 1);
+	cr_assert(n2);
+	cr_expect(eq(u32, n2->mantissa->array[0], 1234));
+	cr_expect(eq(i64, n2->exponent, 1));
+}
+
+TestSuite(float_ops, .init = setup, .fini = teardown);
+
+Test(float_ops, test_far_apart_exponents,
+	 .description = "B^33 - B^-33 to 2 limbs = (B^2 - 1) * B^31",
+	 .timeout = 2.0)
+{
+	n1 = float_from_str("1", 0);
+	n2 = float_from_str("1", 0);
+	cr_assert(n1 && n2);
+	n1->exponent = 33;
+	n2->exponent = -33;
+	result = float_subtraction(n1, n2, 2);
+	cr_assert(result);
+	cr_expect(eq(sz, result->mantissa->len, 2));
+	cr_expect(eq(u32, result->mantissa->array[0], 999999999));
+	cr_expect(eq(u32, result->mantissa->array[1], 999999999));
+	cr_expect(eq(i64, result->exponent, 31));
+}
+
+Test(float_ops, test_division_and_product,
+	 .description = "1 / 3 and (1 / 3) * 3 to 2 limbs", .timeout = 2.0)
+{
+	n1 = float_from_str("1", 2);
+	n2 = float_from_str("3", 2);
+	result = float_division(n1, n2, 0);
+	output = float_str();
+	cr_assert(output);
+	cr_expect(eq(str, output, "0.333333333333333333"));
+	output = free_n_null(output);
+	n1 = free_infiX_float(n1);
+	n1 = result;
+	result = float_multiplication(n1, n2, 0);
+	output = float_str();
+	cr_assert(output);
+	cr_expect(eq(str, output, "0.999999999999999999"));
+}
+
+Test(float_ops, test_sqrt,
+	 .description = "sqrt(2) to 3 limbs, sqrt(-2) fails", .timeout = 2.0)
+{
+	n1 = float_from_str("2", 3);
+	result = float_sqrt(n1, 0);
+	output = float_str();
+	cr_assert(output);
+	cr_expect(eq(str, output, "1.414213562373095048"));
+	n2 = float_from_str("-2", 3);
+	cr_expect(zero(ptr, float_sqrt(n2, 0)));
+}
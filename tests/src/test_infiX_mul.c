@@ -5,14 +5,16 @@ u4b_array num2 = {.len = 0, .is_negative = 0, .array = NULL};
 u4b_array expected = {.len = 0, .is_negative = 0, .array = NULL};
 
 /**
- * infiX_subtraction - dummy
+ * infiX_subtraction_into - dummy
+ * @dest: unused
  * @n1: unused
  * @n2: unused
  *
  * Return: a 0 length array, NULL on failure.
  */
-u4b_array *infiX_subtraction(u4b_array *n1, u4b_array *n2)
+u4b_array *infiX_subtraction_into(u4b_array *dest, const u4b_array *n1, const u4b_array *n2)
 {
+	(void)dest;
 	(void)n1;
 	(void)n2;
 	return (alloc_u4b_array(0));
@@ -297,6 +299,28 @@ Test(simple_multiplications, test_u100d_times_u100c,
 	output = free_u4b_array(output);
 }
 
+Test(simple_multiplications, test_trailing_zero_limbs,
+	 .description = "5,000,000,000,000,000,000,000,000,003 * 7 * 10^36 ="
+					" 35,000,000,000,000,000,000,000,000,021 * 10^36",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {3, 0, 0, 5}, in2[] = {0, 0, 0, 0, 7};
+	uint32_t out[] = {0, 0, 0, 0, 21, 0, 0, 35};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+	num2.len = sizeof(in2) / sizeof(*in2);
+	num2.array = in2;
+	expected.len = sizeof(out) / sizeof(*out);
+	expected.array = out;
+	u4b_array *output = infiX_multiplication(&num1, &num2);
+
+	cr_expect(eq(sz, output->len, expected.len));
+	cr_expect(zero(chr, output->is_negative));
+	cr_expect(eq(u32[expected.len], output->array, expected.array));
+	output = free_u4b_array(output);
+}
+
 TestSuite(negative_multiplications, .init = setup, .fini = teardown);
 
 Test(negative_multiplications, test_minus_u100a_times_minus_u100c,
@@ -502,3 +526,25 @@ Test(large_multiplications, test_medium_largenum1_times_medium_largenum2,
 	cr_expect(eq(u32[expected.len], output->array, expected.array));
 	output = free_u4b_array(output);
 }
+
+Test(large_multiplications, test_high_of_long_product,
+	 .description = "a 1000 limb square without its low 1000 limbs",
+	 .timeout = 2.0)
+{
+	static uint32_t in1[1000];
+	u4b_array *full = NULL, *high = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < 1000; i++)
+		in1[i] = 999999999 - i;
+
+	num1.len = 1000;
+	num1.array = in1;
+	full = infiX_multiplication(&num1, &num1);
+	high = infiX_multiplication_high(&num1, &num1, 1000);
+	cr_assert(full && high);
+	cr_expect(eq(sz, high->len, full->len - 1000));
+	cr_expect(eq(u32[1000], high->array, &full->array[1000]));
+	full = free_u4b_array(full);
+	high = free_u4b_array(high);
+}
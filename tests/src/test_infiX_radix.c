@@ -0,0 +1,97 @@
+#include "tests.h"
+
+u4b_array *num = NULL, *power = NULL;
+char *output = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	num = free_u4b_array(num);
+	power = free_u4b_array(power);
+	output = free_n_null(output);
+	free_radix_powers();
+}
+
+TestSuite(radix_strings, .init = setup, .fini = teardown);
+
+Test(radix_strings, test_hex,
+	 .description = "-FFFF,FFFF,ffff,ffff (hex) = -18446744073709551615",
+	 .timeout = 2.0)
+{
+	num = radix_to_intarray("-FFFF,FFFF,ffff,ffff", 16);
+	cr_assert(num);
+	output = intarr_to_str(num);
+	cr_expect(eq(str, output, "-18446744073709551615"));
+	output = free_n_null(output);
+	output = intarr_to_radix(num, 16);
+	cr_expect(eq(str, output, "-ffffffffffffffff"));
+}
+
+Test(radix_strings, test_binary_and_base_36,
+	 .description = "zz (base 36) = 10100001111 (binary), 0 is \"0\"",
+	 .timeout = 2.0)
+{
+	num = radix_to_intarray("00zz", 36);
+	cr_assert(num);
+	output = intarr_to_radix(num, 2);
+	cr_expect(eq(str, output, "10100001111"));
+	output = free_n_null(output);
+	num = free_u4b_array(num);
+	num = radix_to_intarray("-0", 2);
+	cr_assert(num);
+	output = intarr_to_radix(num, 7);
+	cr_expect(eq(str, output, "0"));
+}
+
+Test(radix_strings, test_invalid_digits,
+	 .description = "\"12\" is not binary, 37 is not a base", .timeout = 2.0)
+{
+	cr_expect(zero(ptr, radix_to_intarray("12", 2)));
+	cr_expect(zero(ptr, radix_to_intarray("1g", 16)));
+	cr_expect(zero(ptr, radix_to_intarray("12", 37)));
+}
+
+Test(radix_strings, test_no_digits,
+	 .description = "\"\", \"-\" and \", ,\" have no digits, \"0\" does",
+	 .timeout = 2.0)
+{
+	cr_expect(zero(ptr, radix_to_intarray("", 16)));
+	cr_expect(zero(ptr, radix_to_intarray("-", 8)));
+	cr_expect(zero(ptr, radix_to_intarray(", ,", 2)));
+	num = radix_to_intarray("0", 16);
+	cr_assert(num);
+	output = intarr_to_radix(num, 16);
+	cr_expect(eq(str, output, "0"));
+}
+
+Test(radix_strings, test_long_hex,
+	 .description = "1000 f's (hex) = 16^1000 - 1, converted both ways",
+	 .timeout = 2.0)
+{
+	uint32_t sixteen[] = {16}, one[] = {1};
+	u4b_array base = {1, 0, 0, sixteen}, unit = {1, 0, 0, one};
+	char digits[1001] = {0};
+	size_t i = 0;
+
+	/*Long enough to be split in halves for both conversions.*/
+	memset(digits, 'f', 1000);
+	power = alloc_u4b_array(1);
+	cr_assert(power);
+	power->array[0] = 1;
+	for (i = 0; i < 1000; i++)
+		cr_assert(infiX_multiplication_into(power, power, &base));
+
+	cr_assert(infiX_subtraction_into(power, power, &unit));
+	num = radix_to_intarray(digits, 16);
+	cr_assert(num);
+	cr_expect(zero(long, cmp_u4barray(num, power)));
+	output = intarr_to_radix(power, 16);
+	cr_expect(eq(str, output, digits));
+}
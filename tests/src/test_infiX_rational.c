@@ -0,0 +1,106 @@
+#include "tests.h"
+
+infiX_rational *n1 = NULL, *n2 = NULL, *result = NULL;
+u4b_array *output = NULL;
+char *output_str = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	n1 = free_infiX_rational(n1);
+	n2 = free_infiX_rational(n2);
+	result = free_infiX_rational(result);
+	output = free_u4b_array(output);
+	output_str = free_n_null(output_str);
+}
+
+TestSuite(gcd, .init = setup, .fini = teardown);
+
+Test(gcd, test_multi_limb_gcd,
+	 .description = "gcd(-(10^36 - 1), 10^27 - 1) = 999,999,999", .timeout = 2.0)
+{
+	uint32_t in1[] = {999999999, 999999999, 999999999, 999999999};
+	uint32_t in2[] = {999999999, 999999999, 999999999};
+	u4b_array num1 = {.len = 4, .is_negative = 1, .array = in1};
+	u4b_array num2 = {.len = 3, .is_negative = 0, .array = in2};
+
+	output = infiX_gcd(&num1, &num2);
+	cr_assert(output);
+	cr_expect(eq(sz, output->len, 1));
+	cr_expect(eq(u32, output->array[0], 999999999));
+	cr_expect(zero(chr, output->is_negative));
+}
+
+Test(gcd, test_gcd_with_zero,
+	 .description = "gcd(0, 12) = 12 and gcd(0, 0) = 0", .timeout = 2.0)
+{
+	uint32_t in1[] = {0}, in2[] = {12};
+	u4b_array num1 = {.len = 1, .is_negative = 0, .array = in1};
+	u4b_array num2 = {.len = 1, .is_negative = 0, .array = in2};
+
+	output = infiX_gcd(&num1, &num2);
+	cr_assert(output);
+	cr_expect(eq(u32, output->array[0], 12));
+	output = free_u4b_array(output);
+	output = infiX_gcd(&num1, &num1);
+	cr_assert(output);
+	cr_expect(zero(u32, output->array[0]));
+}
+
+TestSuite(rationals, .init = setup, .fini = teardown);
+
+Test(rationals, test_lazy_reduction,
+	 .description = "1/6 + 1/3 is 9/18 until printed as 1/2", .timeout = 2.0)
+{
+	n1 = rational_from_str("1/6");
+	n2 = rational_from_str("1/3");
+	result = rational_addition(n1, n2);
+	cr_assert(result);
+	cr_expect(zero(chr, result->is_reduced));
+	cr_expect(eq(u32, result->den->array[0], 18));
+	output_str = rational_to_str(result);
+	cr_assert(output_str);
+	cr_expect(eq(str, output_str, "1/2"));
+	cr_expect(eq(chr, result->is_reduced, 1));
+}
+
+Test(rationals, test_signs_and_compare,
+	 .description = "-2/3 / (4/-9) = 3/2 and -2/3 < 4/-9", .timeout = 2.0)
+{
+	n1 = rational_from_str("-2/3");
+	n2 = rational_from_str("4/-9");
+	result = rational_division(n1, n2);
+	output_str = rational_to_str(result);
+	cr_assert(output_str);
+	cr_expect(eq(str, output_str, "3/2"));
+	cr_expect(lt(long, cmp_rational(n1, n2), 0));
+	cr_expect(zero(ptr, rational_from_str("1/0")));
+}
+
+Test(rationals, test_cross_cancellation,
+	 .description = "(10^90 / 7) * (14 / 10^90) = 2 stays reduced", .timeout = 2.0)
+{
+	uint32_t big[11] = {[10] = 1}, seven[] = {7}, fourteen[] = {14};
+	u4b_array b = {.len = 11, .is_negative = 0, .array = big};
+	u4b_array s = {.len = 1, .is_negative = 0, .array = seven};
+	u4b_array f = {.len = 1, .is_negative = 0, .array = fourteen};
+
+	n1 = rational_new(&b, &s);
+	n2 = rational_new(&f, &b);
+	cr_assert(n1 && n2);
+	cr_assert(zero(int, rational_reduce(n1)));
+	cr_assert(zero(int, rational_reduce(n2)));
+	result = rational_multiplication(n1, n2);
+	cr_assert(result);
+	cr_expect(eq(chr, result->is_reduced, 1));
+	cr_expect(eq(sz, result->num->len, 1));
+	cr_expect(eq(u32, result->num->array[0], 2));
+	cr_expect(eq(u32, result->den->array[0], 1));
+}
@@ -0,0 +1,75 @@
+#include "tests.h"
+
+u4b_array num1 = {.len = 0, .is_negative = 0, .array = NULL};
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	num1.len = 0;
+	num1.is_negative = 0;
+	num1.array = NULL;
+}
+
+TestSuite(single_modulus, .init = setup, .fini = teardown);
+
+Test(single_modulus, test_negative_number,
+	 .description = "-123,456,789,987,654,321,000,000,007 mod 4,294,967,291",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {7, 987654321, 123456789}, residue = 0;
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+
+	cr_assert(zero(int, infiX_residue(&num1, 4294967291u, &residue)));
+	cr_expect(eq(u32, residue, 3897793447u));
+}
+
+Test(single_modulus, test_divisible,
+	 .description = "999,999,999,999,999,999 is divisible by 7", .timeout = 2.0)
+{
+	uint32_t in1[] = {999999999, 999999999}, residue = 1;
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+
+	cr_assert(zero(int, infiX_residue(&num1, 7, &residue)));
+	cr_expect(zero(u32, residue));
+	cr_expect(eq(int, infiX_residue(&num1, 0, &residue), -1));
+}
+
+TestSuite(residue_tables, .init = setup, .fini = teardown);
+
+Test(residue_tables, test_small_primes,
+	 .description = "-123,456,789,987,654,321,000,000,007 mod 3, 7, 11",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {7, 987654321, 123456789}, moduli[] = {3, 7, 11};
+	uint32_t residues[3] = {0}, out[] = {2, 2, 4};
+	residue_table *table = residue_table_new(moduli, 3);
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+
+	cr_assert(table);
+	cr_assert(zero(int, infiX_residues(&num1, table, residues)));
+	cr_expect(eq(u32[3], residues, out));
+	table = free_residue_table(table);
+}
+
+Test(residue_tables, test_zero_modulus,
+	 .description = "a table with a modulus of 0 is rejected", .timeout = 2.0)
+{
+	uint32_t moduli[] = {3, 0};
+
+	cr_expect(zero(ptr, residue_table_new(moduli, 2)));
+}
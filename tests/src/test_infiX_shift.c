@@ -0,0 +1,95 @@
+#include "tests.h"
+
+u4b_array num1 = {.len = 0, .is_negative = 0, .array = NULL};
+u4b_array *output = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	num1.len = 0;
+	num1.is_negative = 0;
+	num1.array = NULL;
+	output = free_u4b_array(output);
+}
+
+TestSuite(shift_left, .init = setup, .fini = teardown);
+
+Test(shift_left, test_shift_13_digits,
+	 .description = "123,456,789,987,654,321 * 10^13", .timeout = 2.0)
+{
+	uint32_t in1[] = {987654321, 123456789};
+	uint32_t out[] = {0, 543210000, 567899876, 1234};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+
+	output = infiX_shift_left(&num1, 13);
+	cr_assert(output);
+	cr_expect(eq(sz, output->len, 4));
+	cr_expect(eq(u32[4], output->array, out));
+}
+
+Test(shift_left, test_in_place,
+	 .description = "shifting a copy in place leaves the original alone",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {987654321, 123456789};
+	uint32_t out[] = {0, 543210000, 567899876, 1234};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+
+	output = dup_u4b_array(&num1);
+	cr_assert(output);
+	cr_assert(eq(ptr, infiX_shift_left_into(output, output, 13), output));
+	cr_expect(eq(sz, output->len, 4));
+	cr_expect(eq(chr, output->is_negative, 1));
+	cr_expect(eq(u32[4], output->array, out));
+	cr_expect(eq(u32, in1[0], 987654321));
+}
+
+TestSuite(shift_right, .init = setup, .fini = teardown);
+
+Test(shift_right, test_floored,
+	 .description = "-123,456,789,987,654,321 / 10^13 = -12,346", .timeout = 2.0)
+{
+	uint32_t in1[] = {987654321, 123456789}, out[] = {12346};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+
+	output = infiX_shift_right(&num1, 13);
+	cr_assert(output);
+	cr_expect(eq(sz, output->len, 1));
+	cr_expect(eq(chr, output->is_negative, 1));
+	cr_expect(eq(u32[1], output->array, out));
+}
+
+Test(shift_right, test_past_all_digits,
+	 .description = "123 / 10^100 = 0 and -123 / 10^100 = -1", .timeout = 2.0)
+{
+	uint32_t in1[] = {123}, out[] = {0}, out_neg[] = {1};
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.array = in1;
+
+	output = infiX_shift_right(&num1, 100);
+	cr_assert(output);
+	cr_expect(eq(u32[1], output->array, out));
+	cr_expect(zero(chr, output->is_negative));
+	output = free_u4b_array(output);
+	num1.is_negative = 1;
+	output = infiX_shift_right(&num1, 100);
+	cr_assert(output);
+	cr_expect(eq(u32[1], output->array, out_neg));
+	cr_expect(eq(chr, output->is_negative, 1));
+}
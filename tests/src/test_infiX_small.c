@@ -0,0 +1,126 @@
+#include "tests.h"
+
+char *output = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	output = free_n_null(output);
+}
+
+TestSuite(parsing, .init = setup, .fini = teardown);
+
+Test(parsing, test_small_with_separators,
+	 .description = "-0,001,234 567 is small", .timeout = 2.0)
+{
+	int64_t value = 0;
+
+	cr_assert(zero(int, small_from_str("-0,001,234 567", &value)));
+	cr_expect(eq(i64, value, -1234567));
+}
+
+Test(parsing, test_int64_range,
+	 .description = "INT64_MIN and INT64_MAX are small, one past them is not",
+	 .timeout = 2.0)
+{
+	int64_t value = 0;
+
+	cr_assert(zero(int, small_from_str("9223372036854775807", &value)));
+	cr_expect(eq(i64, value, INT64_MAX));
+	cr_assert(zero(int, small_from_str("-0009223372036854775808", &value)));
+	cr_expect(eq(i64, value, INT64_MIN));
+	cr_expect(eq(int, small_from_str("9223372036854775808", &value), -1));
+	cr_expect(eq(int, small_from_str("-9223372036854775809", &value), -1));
+}
+
+Test(parsing, test_invalid_chars,
+	 .description = "12a is left to the u4b_array path", .timeout = 2.0)
+{
+	int64_t value = 0;
+
+	cr_expect(eq(int, small_from_str("12a", &value), -1));
+	cr_expect(eq(int, small_from_str(NULL, &value), -1));
+}
+
+Test(parsing, test_small_underscores,
+	 .description = "1_000 is small, _1, 1_ and 1__0 are not", .timeout = 2.0)
+{
+	int64_t value = 0;
+
+	cr_assert(zero(int, small_from_str("-1_000", &value)));
+	cr_expect(eq(i64, value, -1000));
+	cr_expect(eq(int, small_from_str("_1", &value), -1));
+	cr_expect(eq(int, small_from_str("1_", &value), -1));
+	cr_expect(eq(int, small_from_str("1__0", &value), -1));
+}
+
+TestSuite(small_ops, .init = setup, .fini = teardown);
+
+Test(small_ops, test_largest_product,
+	 .description = "999999999999999999 x -999999999999999999", .timeout = 2.0)
+{
+	output = infiX_small("999999999999999999", "x", "-999999999999999999");
+	cr_assert(output);
+	cr_expect(eq(str, output, "-999999999999999998000000000000000001"));
+}
+
+Test(small_ops, test_int64_min_product,
+	 .description = "-9223372036854775808 x -9223372036854775808 = 2^126",
+	 .timeout = 2.0)
+{
+	output = infiX_small("-9223372036854775808", "x", "-9223372036854775808");
+	cr_assert(output);
+	cr_expect(eq(str, output, "85070591730234615865843651857942052864"));
+	output = free_n_null(output);
+	output = infiX_small("-9223372036854775808", "/", "-1");
+	cr_assert(output);
+	cr_expect(eq(str, output, "9223372036854775808"));
+}
+
+Test(small_ops, test_floored_division,
+	 .description = "-8 / 5 = -2 and -8 % 5 = -2", .timeout = 2.0)
+{
+	output = infiX_small("-8", "/", "5");
+	cr_assert(output);
+	cr_expect(eq(str, output, "-2"));
+	output = free_n_null(output);
+	output = infiX_small("-8", "%", "5");
+	cr_assert(output);
+	cr_expect(eq(str, output, "-2"));
+}
+
+Test(small_ops, test_same_sign_modulus,
+	 .description = "-7 % -3 = 1", .timeout = 2.0)
+{
+	output = infiX_small("-7", "%", "-3");
+	cr_assert(output);
+	cr_expect(eq(str, output, "1"));
+}
+
+Test(small_ops, test_bitwise,
+	 .description = "-12 | 10 = -2 and -1 ^ 5 = -6", .timeout = 2.0)
+{
+	output = infiX_small("-12", "|", "10");
+	cr_assert(output);
+	cr_expect(eq(str, output, "-2"));
+	output = free_n_null(output);
+	output = infiX_small("-1", "^", "5");
+	cr_assert(output);
+	cr_expect(eq(str, output, "-6"));
+}
+
+Test(small_ops, test_falls_back,
+	 .description = "division by 0 and unknown operators are not handled",
+	 .timeout = 2.0)
+{
+	cr_expect(zero(ptr, infiX_small("5", "/", "0")));
+	cr_expect(zero(ptr, infiX_small("5", "@", "2")));
+	cr_expect(zero(ptr, infiX_small("5", "+", "10000000000000000000")));
+}
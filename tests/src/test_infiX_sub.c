@@ -5,14 +5,16 @@ u4b_array num2 = {.len = 0, .is_negative = 0, .array = NULL};
 u4b_array expected = {.len = 0, .is_negative = 0, .array = NULL};
 
 /**
- * infiX_addition - Dummy
+ * infiX_addition_into - Dummy
+ * @dest: unused
  * @n1: unused
  * @n2: unused
  *
  * Return: NULL always.
  */
-u4b_array *infiX_addition(u4b_array *n1, u4b_array *n2)
+u4b_array *infiX_addition_into(u4b_array *dest, const u4b_array *n1, const u4b_array *n2)
 {
+	(void)dest;
 	(void)n1;
 	(void)n2;
 	return (alloc_u4b_array(0));
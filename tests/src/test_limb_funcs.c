@@ -0,0 +1,281 @@
+#include "tests.h"
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void) {}
+
+TestSuite(add_sub, .init = setup, .fini = teardown);
+
+Test(add_sub, test_add_carries_out,
+	 .description = "999,999,999,999,999,999 + 1 = 1,000,000,000,000,000,000",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {999999999, 999999999}, in2[] = {1};
+	uint32_t out[] = {0, 0};
+
+	cr_expect(eq(u32, limbs_add(in1, in1, 2, in2, 1), 1));
+	cr_expect(eq(u32[2], in1, out));
+}
+
+Test(add_sub, test_sub_borrows_through,
+	 .description = "1,000,000,000,000,000,000 - 1 = 999,999,999,999,999,999",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {0, 0, 1}, in2[] = {1};
+	uint32_t out[] = {999999999, 999999999, 0};
+
+	cr_expect(zero(u32, limbs_sub(in1, in1, 3, in2, 1)));
+	cr_expect(eq(u32[3], in1, out));
+}
+
+Test(add_sub, test_sub_n_borrows_out,
+	 .description = "1 - 2 borrows 1", .timeout = 2.0)
+{
+	uint32_t in1[] = {1}, in2[] = {2}, res[1] = {0};
+	uint32_t out[] = {999999999};
+
+	cr_expect(eq(u32, limbs_sub_n(res, in1, in2, 1), 1));
+	cr_expect(eq(u32[1], res, out));
+}
+
+TestSuite(mul_div, .init = setup, .fini = teardown);
+
+Test(mul_div, test_mul_1_and_divrem_1,
+	 .description = "(123,456,789,987,654,321 * 7) / 7 has remainder 0",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {987654321, 123456789}, res[2] = {0};
+	uint32_t out[] = {913580247, 864197529};
+
+	cr_expect(zero(u32, limbs_mul_1(res, in1, 2, 7)));
+	cr_expect(eq(u32[2], res, out));
+	cr_expect(zero(u32, limbs_divrem_1(res, res, 2, 7)));
+	cr_expect(eq(u32[2], res, in1));
+}
+
+Test(mul_div, test_addmul_submul_inverse,
+	 .description = "submul_1 undoes addmul_1", .timeout = 2.0)
+{
+	uint32_t in1[] = {999999999, 999999999}, res[] = {5, 6};
+	uint32_t out[] = {5, 6};
+
+	cr_expect(eq(u32, limbs_addmul_1(res, in1, 2, 999999999), 999999999));
+	cr_expect(eq(u32, limbs_submul_1(res, in1, 2, 999999999), 999999999));
+	cr_expect(eq(u32[2], res, out));
+}
+
+Test(mul_div, test_divrem_multi_limb,
+	 .description = "2,100,550,005,550,000,000,000,000,045,000,000,000,005,000,065,000 /"
+					" 75,006,000,000,000",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {65000, 5, 45000, 0, 550005550, 2100};
+	uint32_t in2[] = {0, 75006};
+	uint32_t out[] = {208916620, 865984055, 999893341, 28005092, 0};
+	uint32_t rem[] = {65000, 285};
+	uint32_t quotient[5] = {0}, remainder[2] = {0}, scratch[9] = {0};
+
+	cr_assert(eq(sz, limbs_divrem_itch(6, 2), 9));
+	limbs_divrem(quotient, remainder, in1, 6, in2, 2, scratch);
+	cr_expect(eq(u32[5], quotient, out));
+	cr_expect(eq(u32[2], remainder, rem));
+}
+
+Test(mul_div, test_divexact,
+	 .description = "75,006,000,000,000 x 123,456,789,000,000,007 / 75,006,000,000,000",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {0, 525042, 999915734, 9259}, in2[] = {0, 75006};
+	uint32_t out[] = {7, 123456789, 0}, quotient[3] = {0}, scratch[6] = {0};
+
+	cr_assert(eq(sz, limbs_divexact_itch(4, 2), 6));
+	limbs_divexact(quotient, in1, 4, in2, 2, scratch);
+	cr_expect(eq(u32[3], quotient, out));
+}
+
+Test(mul_div, test_divrem_1_preinv,
+	 .description = "123,456,789,987,654,321 / 999,999,937 with a reciprocal",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {987654321, 123456789}, res[2] = {0};
+	uint32_t out[] = {123456797, 0};
+
+	cr_expect(eq(u32, limbs_divrem_1_preinv(res, in1, 2, 999999937,
+											limbs_invert_limb(999999937)),
+				 765432532));
+	cr_expect(eq(u32[2], res, out));
+}
+
+Test(mul_div, test_mul_high,
+	 .description = "top limbs of (10^45 - 1)^2 without the low 4", .timeout = 2.0)
+{
+	uint32_t in1[5], full[10] = {0}, high[6] = {0};
+	size_t i = 0;
+
+	for (i = 0; i < 5; i++)
+		in1[i] = 999999999;
+
+	limbs_mul(full, in1, 5, in1, 5, NULL);
+	limbs_mul_high(high, in1, 5, in1, 5, 4);
+	/*The dropped limb products do not carry past the guard limbs here.*/
+	cr_expect(eq(u32[3], &high[MUL_HIGH_GUARD_LIMBS], &full[7]));
+}
+
+Test(mul_div, test_mul_high_wins,
+	 .description = "short products of 1000 limbs only pay when most is dropped",
+	 .timeout = 2.0)
+{
+	cr_expect(eq(int, limbs_mul_high_wins(5, 5, 6), 1));
+	cr_expect(eq(int, limbs_mul_high_wins(4000, 8, 4000), 1));
+	cr_expect(zero(int, limbs_mul_high_wins(1000, 1000, 1000)));
+	cr_expect(eq(int, limbs_mul_high_wins(1000, 1000, 1600), 1));
+}
+
+TestSuite(shifts, .init = setup, .fini = teardown);
+
+Test(shifts, test_lshift_rshift,
+	 .description = "shifting left then right by 2 limbs is a no-op",
+	 .timeout = 2.0)
+{
+	uint32_t res[] = {1, 2, 0, 0};
+	uint32_t out[] = {0, 0, 1, 2}, in1[] = {1, 2};
+
+	limbs_lshift(res, res, 2, 2);
+	cr_expect(eq(u32[4], res, out));
+	cr_expect(zero(int, limbs_cmp(res, out, 4)));
+	limbs_rshift(res, res, 4, 2);
+	cr_expect(eq(u32[2], res, in1));
+	cr_expect(eq(int, limbs_cmp(res, out, 2), 1));
+}
+
+TestSuite(unbalanced, .init = setup, .fini = teardown);
+
+Test(unbalanced, test_chunked_product,
+	 .description = "(10^(9 * 600) - 1) * 999,999,999 in either order",
+	 .timeout = 2.0)
+{
+	uint32_t in1[600], in2[] = {999999999}, res1[601] = {0}, res2[601] = {0};
+	size_t i = 0;
+
+	for (i = 0; i < 600; i++)
+		in1[i] = 999999999;
+
+	limbs_mul(res1, in1, 600, in2, 1, NULL);
+	limbs_mul(res2, in2, 1, in1, 600, NULL);
+	/*(B^600 - 1) * (B - 1) = (B - 2) * B^600 + (B^600 - B) + 1*/
+	cr_expect(eq(u32, res1[0], 1));
+	for (i = 1; i < 600; i++)
+		cr_expect(eq(u32, res1[i], 999999999));
+
+	cr_expect(eq(u32, res1[600], 999999998));
+	cr_expect(eq(u32[601], res1, res2));
+}
+
+Test(unbalanced, test_karatsuba_product,
+	 .description = "(10^(9 * 100) - 1)^2 by Karatsuba", .timeout = 2.0)
+{
+	uint32_t in1[100], res1[200] = {0}, *scratch = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < 100; i++)
+		in1[i] = 999999999;
+
+	scratch = xmalloc(sizeof(*scratch) * limbs_mul_n_itch(100));
+	cr_assert(scratch);
+	limbs_mul_n(res1, in1, in1, 100, scratch);
+	scratch = free_n_null(scratch);
+	/*(B^100 - 1)^2 = (B^100 - 2) * B^100 + 1*/
+	cr_expect(eq(u32, res1[0], 1));
+	cr_expect(eq(u32, res1[100], 999999998));
+	for (i = 1; i < 100; i++)
+	{
+		cr_expect(zero(u32, res1[i]));
+		cr_expect(eq(u32, res1[100 + i], 999999999));
+	}
+}
+
+Test(unbalanced, test_karatsuba_chunks,
+	 .description = "250 limbs x 40 limbs in Karatsuba chunks, against rows",
+	 .timeout = 2.0)
+{
+	uint32_t in1[250], in2[40], res1[290] = {0}, res2[290] = {0};
+	uint32_t *scratch = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < 250; i++)
+		in1[i] = (uint32_t)((i * 2654435761u) % MAX_VAL_u4b);
+
+	for (i = 0; i < 40; i++)
+		in2[i] = MAX_VAL_u4b - 1 - (uint32_t)i;
+
+	cr_assert(limbs_mul_itch(40, 250));
+	scratch = xmalloc(sizeof(*scratch) * limbs_mul_itch(40, 250));
+	cr_assert(scratch);
+	limbs_mul(res1, in2, 40, in1, 250, scratch);
+	scratch = free_n_null(scratch);
+	for (i = 0; i < 40; i++)
+		res2[250 + i] = limbs_addmul_1(&res2[i], in1, 250, in2[i]);
+
+	for (i = 0; i < 290; i++)
+		cr_expect(eq(u32, res1[i], res2[i]));
+}
+
+TestSuite(sparse, .init = setup, .fini = teardown);
+
+Test(sparse, test_runs_and_product,
+	 .description = "runs of [5, 0, 0, 7, 8, 0, 1] and the product by B^3 - 1",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {5, 0, 0, 7, 8, 0, 1}, in2[] = {999999999, 999999999, 999999999};
+	uint32_t res1[10] = {0}, res2[10] = {0};
+	size_t runs[6] = {0}, out[] = {0, 1, 3, 5, 6, 7}, nonzero = 0, i = 0;
+
+	cr_expect(eq(sz, limbs_runs(NULL, in1, 7, &nonzero), 3));
+	cr_expect(eq(sz, nonzero, 4));
+	cr_assert(eq(sz, limbs_runs(runs, in1, 7, NULL), 3));
+	for (i = 0; i < 6; i++)
+		cr_expect(eq(sz, runs[i], out[i]));
+
+	limbs_mul_sparse(res1, in1, 7, runs, 3, in2, 3);
+	limbs_mul(res2, in1, 7, in2, 3, NULL);
+	cr_expect(eq(u32[10], res1, res2));
+}
+
+Test(sparse, test_half_dense_is_dense,
+	 .description = "3000 limbs, half of them zero, go to limbs_mul()",
+	 .timeout = 2.0)
+{
+	static uint32_t in1[3000];
+	size_t nonzero = 0, nruns = 0, i = 0;
+	uint32_t seed = 12345;
+
+	for (i = 0; i < 3000; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		in1[i] = (seed >> 16) & 1 ? seed % MAX_VAL_u4b : 0;
+	}
+
+	nruns = limbs_runs(NULL, in1, 3000, &nonzero);
+	cr_assert(gt(sz, nonzero, 1200));
+	cr_expect(zero(int, limbs_mul_sparse_wins(3000, nonzero, nruns, 3000,
+											  nonzero)));
+	/*A nonzero limb in every hundred is worth indexing.*/
+	cr_expect(eq(int, limbs_mul_sparse_wins(3000, 30, 30, 3000, 30), 1));
+}
+
+Test(sparse, test_karatsuba_cost,
+	 .description = "4000 limbs a fifth nonzero are not sparse next to Karatsuba",
+	 .timeout = 2.0)
+{
+	cr_expect(eq(sz, limbs_mul_cost(4000, 15), 60000));
+	cr_expect(lt(sz, limbs_mul_cost(4000, 4000), 4000 * 4000 / 4));
+	/*800 nonzero limbs in 640 runs, as a random fifth of them would be.*/
+	cr_expect(zero(int, limbs_mul_sparse_wins(4000, 800, 640, 4000, 800)));
+	cr_expect(eq(int, limbs_mul_sparse_wins(4000, 200, 190, 4000, 200), 1));
+}
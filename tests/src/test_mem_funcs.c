@@ -0,0 +1,231 @@
+#include "tests.h"
+
+u4b_array num1 = {.len = 0, .is_negative = 0, .array = NULL};
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	num1.len = 0;
+	num1.capacity = 0;
+	num1.is_negative = 0;
+	num1.array = NULL;
+}
+
+TestSuite(reserve, .init = setup, .fini = teardown);
+
+Test(reserve, test_reserve_grows_geometrically,
+	 .description = "reserve(len + 1) at least doubles the capacity", .timeout = 2.0)
+{
+	u4b_array *arr = alloc_u4b_array(LIMB_PADDING);
+
+	cr_assert(zero(long, reserve_u4b_array(arr, LIMB_PADDING + 1)));
+	cr_expect(eq(sz, arr->capacity, LIMB_PADDING * 2));
+	cr_expect(eq(sz, arr->len, LIMB_PADDING));
+	arr = free_u4b_array(arr);
+}
+
+Test(reserve, test_resize_reuses_buffer,
+	 .description = "shrinking then growing within capacity keeps the buffer",
+	 .timeout = 2.0)
+{
+	u4b_array *arr = alloc_u4b_array(8);
+	uint32_t *buffer = arr->array;
+	uint32_t out[] = {0, 0, 0, 0, 0, 0};
+
+	arr->array[5] = 7;
+	cr_assert(zero(long, resize_u4b_array(arr, 2)));
+	cr_assert(zero(long, resize_u4b_array(arr, 6)));
+	cr_expect(eq(ptr, arr->array, buffer));
+	cr_expect(eq(u32[6], arr->array, out));
+	arr = free_u4b_array(arr);
+}
+
+Test(reserve, test_reserve_copies_unowned_array,
+	 .description = "reserve on a stack array copies it", .timeout = 2.0)
+{
+	uint32_t in1[] = {1, 2, 3};
+	u4b_array *arr = alloc_u4b_array(0);
+
+	cr_assert(arr);
+	arr->len = sizeof(in1) / sizeof(*in1);
+	arr->array = in1;
+	cr_assert(zero(long, reserve_u4b_array(arr, 4)));
+	cr_expect(ne(ptr, arr->array, in1));
+	cr_expect(eq(sz, arr->len, 3));
+	cr_expect(eq(u32[3], arr->array, in1));
+	arr = free_u4b_array(arr);
+}
+
+Test(reserve, test_buffers_aligned_and_padded,
+	 .description = "limbs are aligned and zero up to a padded capacity",
+	 .timeout = 2.0)
+{
+	u4b_array *arr = alloc_u4b_array(3);
+	size_t i = 0;
+
+	cr_assert(arr);
+	cr_expect(zero(sz, (uintptr_t)arr->array % LIMB_ALIGNMENT));
+	cr_expect(eq(sz, arr->capacity, LIMB_PADDING));
+	arr->array[2] = 9;
+	cr_assert(zero(long, resize_u4b_array(arr, 1)));
+	cr_assert(zero(long, reserve_u4b_array(arr, LIMB_PADDING * 5)));
+	cr_expect(zero(sz, (uintptr_t)arr->array % LIMB_ALIGNMENT));
+	for (i = arr->len; i < arr->capacity; i++)
+		cr_assert(zero(u32, arr->array[i]));
+
+	arr = free_u4b_array(arr);
+}
+
+TestSuite(copy_on_write, .init = setup, .fini = teardown);
+
+Test(copy_on_write, test_dup_shares_buffer,
+	 .description = "dup shares the buffer until a write", .timeout = 2.0)
+{
+	u4b_array *arr = alloc_u4b_array(3), *copy = NULL;
+	uint32_t out[] = {1, 2, 3};
+
+	memmove(arr->array, out, sizeof(out));
+	copy = dup_u4b_array(arr);
+	cr_assert(copy);
+	cr_expect(eq(ptr, copy->array, arr->array));
+	cr_expect(is_shared_u4b_array(arr));
+
+	cr_assert(zero(long, unshare_u4b_array(copy)));
+	copy->array[0] = 9;
+	cr_expect(ne(ptr, copy->array, arr->array));
+	cr_expect(eq(u32[3], arr->array, out));
+	cr_expect(zero(long, is_shared_u4b_array(arr)));
+	arr = free_u4b_array(arr);
+	copy = free_u4b_array(copy);
+}
+
+Test(copy_on_write, test_free_keeps_shared_buffer,
+	 .description = "freeing one duplicate leaves the other intact", .timeout = 2.0)
+{
+	u4b_array *arr = alloc_u4b_array(3), *copy = NULL;
+	uint32_t out[] = {4, 5, 6};
+
+	memmove(arr->array, out, sizeof(out));
+	copy = dup_u4b_array(arr);
+	arr = free_u4b_array(arr);
+	cr_expect(eq(u32[3], copy->array, out));
+	cr_expect(zero(long, is_shared_u4b_array(copy)));
+	copy = free_u4b_array(copy);
+}
+
+Test(copy_on_write, test_dup_copies_unowned_array,
+	 .description = "dup of a stack array is a deep copy", .timeout = 2.0)
+{
+	uint32_t in1[] = {1, 2};
+	u4b_array *copy = NULL;
+
+	num1.len = sizeof(in1) / sizeof(*in1);
+	num1.is_negative = 1;
+	num1.array = in1;
+	copy = dup_u4b_array(&num1);
+	cr_assert(copy);
+	cr_expect(ne(ptr, copy->array, in1));
+	cr_expect(eq(chr, copy->is_negative, 1));
+	cr_expect(eq(u32[2], copy->array, in1));
+	copy = free_u4b_array(copy);
+}
+
+/**
+ * struct alloc_counts - bookkeeping for the counting allocator.
+ * @allocs: number of successful alloc and realloc(NULL) calls
+ * @frees: number of free calls with a non NULL pointer
+ */
+typedef struct alloc_counts
+{
+	size_t allocs;
+	size_t frees;
+} alloc_counts;
+
+/**
+ * count_alloc - allocator_hooks alloc that counts calls.
+ * @size: size in bytes to allocate.
+ * @ctx: pointer to an alloc_counts.
+ *
+ * Return: a pointer to the memory area, NULL on failure.
+ */
+void *count_alloc(size_t size, void *ctx)
+{
+	((alloc_counts *)ctx)->allocs++;
+	return (malloc(size));
+}
+
+/**
+ * count_realloc - allocator_hooks realloc that counts calls.
+ * @ptr: pointer to the memory area to resize.
+ * @size: the new size in bytes.
+ * @ctx: pointer to an alloc_counts.
+ *
+ * Return: a pointer to the memory area, NULL on failure.
+ */
+void *count_realloc(void *ptr, size_t size, void *ctx)
+{
+	if (!ptr)
+		((alloc_counts *)ctx)->allocs++;
+
+	return (realloc(ptr, size));
+}
+
+/**
+ * count_free - allocator_hooks free that counts calls.
+ * @ptr: a freeable pointer.
+ * @ctx: pointer to an alloc_counts.
+ */
+void count_free(void *ptr, void *ctx)
+{
+	if (ptr)
+		((alloc_counts *)ctx)->frees++;
+
+	free(ptr);
+}
+
+TestSuite(hooks, .init = setup, .fini = teardown);
+
+Test(hooks, test_process_hooks_used,
+	 .description = "every allocation goes through set_allocator_hooks()",
+	 .timeout = 2.0)
+{
+	alloc_counts counts = {0};
+	allocator_hooks hooks = {
+		.alloc = count_alloc, .realloc = count_realloc, .free = count_free, .ctx = &counts};
+	u4b_array *arr = NULL;
+
+	set_allocator_hooks(&hooks);
+	arr = alloc_u4b_array(2);
+	cr_assert(zero(long, reserve_u4b_array(arr, 100)));
+	arr = free_u4b_array(arr);
+	set_allocator_hooks(NULL);
+
+	cr_expect(eq(sz, counts.allocs, 2));
+	cr_expect(eq(sz, counts.frees, 2));
+}
+
+Test(hooks, test_limbs_freed_with_their_allocator,
+	 .description = "a thread's hooks free the limbs they allocated after being unset",
+	 .timeout = 2.0)
+{
+	alloc_counts counts = {0};
+	allocator_hooks hooks = {
+		.alloc = count_alloc, .realloc = count_realloc, .free = count_free, .ctx = &counts};
+	u4b_array *arr = alloc_u4b_array(0);
+
+	cr_assert(arr);
+	set_thread_allocator_hooks(&hooks);
+	cr_assert(zero(long, resize_u4b_array(arr, 4)));
+	cr_expect(eq(ptr, (void *)set_thread_allocator_hooks(NULL), &hooks));
+	arr = free_u4b_array(arr);
+
+	cr_expect(eq(sz, counts.allocs, 1));
+	cr_expect(eq(sz, counts.frees, 1));
+}
@@ -0,0 +1,104 @@
+#include "tests.h"
+
+u4b_array *output = NULL;
+sparse_u4b *n1 = NULL, *n2 = NULL, *result = NULL;
+
+/**
+ * setup - initialises variables for tests.
+ */
+void setup(void) {}
+
+/**
+ * teardown - resets variables for tests.
+ */
+void teardown(void)
+{
+	output = free_u4b_array(output);
+	n1 = free_sparse_u4b(n1);
+	n2 = free_sparse_u4b(n2);
+	result = free_sparse_u4b(result);
+}
+
+TestSuite(runs, .init = setup, .fini = teardown);
+
+Test(runs, test_round_trip,
+	 .description = "short gaps stay inside a run, long ones are dropped",
+	 .timeout = 2.0)
+{
+	uint32_t in1[] = {5, 0, 0, 7, 0, 0, 0, 0, 0, 1, 0, 0};
+	u4b_array num1 = {.len = 12, .is_negative = 1, .array = in1};
+
+	n1 = sparse_from_u4b(&num1);
+	cr_assert(n1);
+	cr_expect(eq(sz, n1->len, 10));
+	cr_expect(eq(sz, n1->nruns, 2));
+	cr_expect(eq(sz, n1->nlimbs, 5));
+	cr_expect(eq(sz, n1->runs[1].offset, 9));
+	output = sparse_to_u4b(n1);
+	cr_assert(output);
+	cr_expect(eq(sz, output->len, 10));
+	cr_expect(eq(chr, output->is_negative, 1));
+	cr_expect(eq(u32[10], output->array, in1));
+}
+
+TestSuite(sparse_ops, .init = setup, .fini = teardown);
+
+Test(sparse_ops, test_carry_into_gap,
+	 .description = "(10^90 + 999,999,999) + 1 = 10^90 + 10^9", .timeout = 2.0)
+{
+	uint32_t in1[11] = {999999999, [10] = 1}, in2[] = {1}, out[11] = {0, 1, [10] = 1};
+	u4b_array num1 = {.len = 11, .is_negative = 0, .array = in1};
+	u4b_array num2 = {.len = 1, .is_negative = 0, .array = in2};
+
+	n1 = sparse_from_u4b(&num1);
+	n2 = sparse_from_u4b(&num2);
+	result = sparse_addition(n1, n2);
+	cr_assert(result);
+	cr_expect(eq(sz, result->nruns, 2));
+	output = sparse_to_u4b(result);
+	cr_assert(output);
+	cr_expect(eq(u32[11], output->array, out));
+}
+
+Test(sparse_ops, test_borrow_fills_gap,
+	 .description = "1 - 10^90 = -(10^90 - 1), a single dense run", .timeout = 2.0)
+{
+	uint32_t in1[] = {1}, in2[11] = {[10] = 1};
+	u4b_array num1 = {.len = 1, .is_negative = 0, .array = in1};
+	u4b_array num2 = {.len = 11, .is_negative = 0, .array = in2};
+	size_t i = 0;
+
+	n1 = sparse_from_u4b(&num1);
+	n2 = sparse_from_u4b(&num2);
+	cr_expect(lt(long, cmp_sparse_u4b(n1, n2), 0));
+	result = sparse_subtraction(n1, n2);
+	cr_assert(result);
+	cr_expect(eq(sz, result->nruns, 1));
+	cr_expect(eq(chr, result->is_negative, 1));
+	output = sparse_to_u4b(result);
+	cr_assert(output);
+	cr_expect(eq(sz, output->len, 10));
+	for (i = 0; i < 10; i++)
+		cr_expect(eq(u32, output->array[i], 999999999));
+}
+
+Test(sparse_ops, test_zero_and_dense_op,
+	 .description = "x - x is 0 and the dense fallback adds", .timeout = 2.0)
+{
+	uint32_t in1[] = {5, 0, 0, 0, 0, 0, 3}, out[] = {10, 0, 0, 0, 0, 0, 6};
+	u4b_array num1 = {.len = 7, .is_negative = 1, .array = in1};
+
+	n1 = sparse_from_u4b(&num1);
+	result = sparse_subtraction(n1, n1);
+	cr_assert(result);
+	cr_expect(zero(sz, result->nruns));
+	cr_expect(zero(chr, result->is_negative));
+	cr_expect(zero(long, cmp_sparse_u4b(result, result)));
+	result = free_sparse_u4b(result);
+	result = sparse_dense_op(infiX_addition, n1, n1);
+	cr_assert(result);
+	output = sparse_to_u4b(result);
+	cr_assert(output);
+	cr_expect(eq(chr, output->is_negative, 1));
+	cr_expect(eq(u32[7], output->array, out));
+}